@@ -0,0 +1,287 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: MF_AISyncScheduler - Implementation
+ * @Date: 16/10/2026
+ */
+
+#include "AI/MF_AISyncScheduler.h"
+#include "Player/MF_PlayerCharacter.h"
+#include "Core/MF_PlayerSnapshotSubsystem.h"
+#include "Core/MF_Stats.h"
+#include "AIComponent.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Async/ParallelFor.h"
+
+DEFINE_STAT(STAT_MF_AISyncAgents);
+DEFINE_STAT(STAT_MF_AISyncDeferred);
+DECLARE_CYCLE_STAT(TEXT("AI Blackboard Sync"), STAT_MF_AISync, STATGROUP_MiniFootball);
+
+namespace
+{
+    TAutoConsoleVariable<int32> CVarAISyncScheduler(
+        TEXT("MF.AI.SyncScheduler"),
+        1,
+        TEXT("1 = sync AI blackboards just before each agent's AI tick, time-sliced across frames (default).\n")
+            TEXT("0 = sync every agent every frame. Applies to agents whose AI (re)starts after the change."),
+        ECVF_Default);
+
+    TAutoConsoleVariable<int32> CVarAISyncBuckets(
+        TEXT("MF.AI.SyncBuckets"),
+        5,
+        TEXT("Number of phase buckets AI agents are spread over within one AI tick interval."),
+        ECVF_Default);
+
+    TAutoConsoleVariable<float> CVarAISyncBudgetUs(
+        TEXT("MF.AI.SyncBudgetUs"),
+        1000.0f,
+        TEXT("Per-frame budget for AI blackboard syncs in microseconds (0 = unlimited).\n")
+            TEXT("Agents nearest the ball are synced first; agents over budget keep last tick's data."),
+        ECVF_Default);
+
+    TAutoConsoleVariable<int32> CVarAIParallelPerception(
+        TEXT("MF.AI.ParallelPerception"),
+        1,
+        TEXT("1 = compute per-agent perception (nearest opponent, clear shot, striker, support position) with ParallelFor.\n")
+            TEXT("0 = compute serially on the game thread (for benchmarking)."),
+        ECVF_Default);
+}
+
+UMF_AISyncScheduler *UMF_AISyncScheduler::Get(const UObject *WorldContextObject)
+{
+    const UWorld *World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    return World ? World->GetSubsystem<UMF_AISyncScheduler>() : nullptr;
+}
+
+TStatId UMF_AISyncScheduler::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UMF_AISyncScheduler, STATGROUP_Tickables);
+}
+
+void UMF_AISyncScheduler::Deinitialize()
+{
+    // World is going away with its agents; nothing to restore
+    Agents.Reset();
+    DueScratch.Reset();
+
+    Super::Deinitialize();
+}
+
+// ==================== Registration ====================
+
+bool UMF_AISyncScheduler::RegisterAgent(AMF_PlayerCharacter *Character)
+{
+    UAIComponent *AIComp = Character ? Character->GetAIComponent() : nullptr;
+    if (!AIComp || CVarAISyncScheduler.GetValueOnGameThread() == 0 || Character->AITickInterval <= 0.0f)
+    {
+        UnregisterAgent(Character);
+        return false;
+    }
+
+    FAgent *Agent = Agents.FindByPredicate([Character](const FAgent &Entry)
+                                           { return Entry.Character.Get() == Character; });
+    if (!Agent)
+    {
+        Agent = &Agents.AddDefaulted_GetRef();
+        Agent->Character = Character;
+        Agent->Bucket = PickBucket();
+    }
+
+    // Hold the AI tick until this agent's phase comes round, then run it on a UE tick interval
+    const double Interval = Character->AITickInterval;
+    const int32 NumBuckets = FMath::Max(1, CVarAISyncBuckets.GetValueOnGameThread());
+    const double Offset = Interval * (Agent->Bucket % NumBuckets) / NumBuckets;
+    const double Now = GetWorld()->GetTimeSeconds();
+
+    Agent->JoinTime = FMath::CeilToDouble((Now - Offset) / Interval) * Interval + Offset;
+    Agent->bDeferred = false;
+
+    AIComp->TickInterval = 0.0f;
+    AIComp->SetComponentTickEnabled(false);
+    Character->bBlackboardSyncScheduled = true;
+
+    return true;
+}
+
+void UMF_AISyncScheduler::UnregisterAgent(AMF_PlayerCharacter *Character)
+{
+    const int32 Removed = Agents.RemoveAllSwap([Character](const FAgent &Entry)
+                                               { return Entry.Character.Get() == Character; });
+
+    if (Removed > 0 && Character)
+    {
+        if (UAIComponent *AIComp = Character->GetAIComponent())
+        {
+            AIComp->TickInterval = Character->AITickInterval;
+            AIComp->SetComponentTickIntervalAndCooldown(0.0f);
+            AIComp->SetComponentTickEnabled(true);
+        }
+        Character->bBlackboardSyncScheduled = false;
+    }
+}
+
+bool UMF_AISyncScheduler::IsScheduled(const AMF_PlayerCharacter *Character) const
+{
+    return Agents.ContainsByPredicate([Character](const FAgent &Entry)
+                                      { return Entry.Character.Get() == Character; });
+}
+
+int32 UMF_AISyncScheduler::PickBucket() const
+{
+    const int32 NumBuckets = FMath::Max(1, CVarAISyncBuckets.GetValueOnGameThread());
+
+    TArray<int32, TInlineAllocator<16>> Counts;
+    Counts.SetNumZeroed(NumBuckets);
+    for (const FAgent &Agent : Agents)
+    {
+        ++Counts[Agent.Bucket % NumBuckets];
+    }
+
+    int32 Best = 0;
+    for (int32 Bucket = 1; Bucket < NumBuckets; ++Bucket)
+    {
+        if (Counts[Bucket] < Counts[Best])
+        {
+            Best = Bucket;
+        }
+    }
+    return Best;
+}
+
+void UMF_AISyncScheduler::JoinBucket(FAgent &Agent, double Now)
+{
+    AMF_PlayerCharacter *Character = Agent.Character.Get();
+    UAIComponent *AIComp = Character->GetAIComponent();
+
+    AIComp->SetComponentTickEnabled(true);
+    AIComp->SetComponentTickIntervalAndCooldown(Character->AITickInterval);
+
+    Agent.NextAITickTime = Now + Character->AITickInterval;
+    Agent.JoinTime = -1.0;
+}
+
+// ==================== Tick ====================
+
+void UMF_AISyncScheduler::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    Agents.RemoveAllSwap([](const FAgent &Entry)
+                         { return !Entry.Character.IsValid(); });
+    if (Agents.Num() == 0)
+    {
+        return;
+    }
+
+    SCOPE_CYCLE_COUNTER(STAT_MF_AISync);
+
+    // Runs at the end of the frame: anything whose AI tick falls in the next frame is due now
+    const double Now = GetWorld()->GetTimeSeconds();
+    const double Horizon = Now + DeltaTime;
+
+    DueScratch.Reset();
+    for (int32 Index = 0; Index < Agents.Num(); ++Index)
+    {
+        FAgent &Agent = Agents[Index];
+        AMF_PlayerCharacter *Character = Agent.Character.Get();
+        if (!Character->IsAIRunning())
+        {
+            continue;
+        }
+
+        if (Agent.JoinTime >= 0.0)
+        {
+            if (Now < Agent.JoinTime)
+            {
+                continue;
+            }
+            JoinBucket(Agent, Now);
+        }
+
+        if (Agent.NextAITickTime <= Horizon)
+        {
+            DueScratch.Add(Index);
+        }
+    }
+
+    if (DueScratch.Num() == 0)
+    {
+        return;
+    }
+
+    UMF_PlayerSnapshotSubsystem *Snapshots = UMF_PlayerSnapshotSubsystem::Get(this);
+    if (!Snapshots)
+    {
+        return;
+    }
+
+    // Movement has run since the snapshot was built this frame
+    Snapshots->Invalidate();
+    const FMF_PlayerSnapshot &Snapshot = Snapshots->GetSnapshot();
+
+    // Priority: agents deferred last time first, then nearest to the ball
+    auto DistSqToBall = [&Snapshot](const AMF_PlayerCharacter *Character)
+    {
+        const int32 SnapshotIndex = Snapshot.IndexOf(Character);
+        return SnapshotIndex != INDEX_NONE ? FVector::DistSquared(Snapshot.Positions[SnapshotIndex], Snapshot.BallLocation) : MAX_dbl;
+    };
+    if (DueScratch.Num() > 1)
+    {
+        DueScratch.Sort([this, &DistSqToBall](int32 A, int32 B)
+                        {
+                            if (Agents[A].bDeferred != Agents[B].bDeferred)
+                            {
+                                return Agents[A].bDeferred;
+                            }
+                            return DistSqToBall(Agents[A].Character.Get()) < DistSqToBall(Agents[B].Character.Get()); });
+    }
+
+    // Budget: how many agents fit, from the measured average cost per agent (always at least one)
+    const double BudgetSeconds = FMath::Max(0.0f, CVarAISyncBudgetUs.GetValueOnGameThread()) * 1.0e-6;
+    const int32 Synced = BudgetSeconds > 0.0
+                             ? FMath::Clamp(FMath::FloorToInt32(BudgetSeconds / FMath::Max(AverageAgentSeconds, 1.0e-7)), 1, DueScratch.Num())
+                             : DueScratch.Num();
+
+    const uint64 StartCycles = FPlatformTime::Cycles64();
+
+    // Game thread: target lookups each perception pass needs
+    Inputs.SetNum(Synced, EAllowShrinking::No);
+    Perceptions.SetNum(Synced, EAllowShrinking::No);
+    for (int32 Slot = 0; Slot < Synced; ++Slot)
+    {
+        Agents[DueScratch[Slot]].Character->GatherPerceptionInput(Snapshot, Inputs[Slot]);
+    }
+
+    // Any thread: perception over the frozen snapshot
+    const bool bParallel = CVarAIParallelPerception.GetValueOnGameThread() != 0;
+    ParallelFor(Synced, [this, &Snapshot](int32 Slot)
+                {
+                    Perceptions[Slot] = FMF_AgentPerception();
+                    Agents[DueScratch[Slot]].Character->ComputePerception(Snapshot, Inputs[Slot], Perceptions[Slot]); },
+                bParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+
+    // Game thread: apply to blackboards
+    for (int32 Slot = 0; Slot < Synced; ++Slot)
+    {
+        Agents[DueScratch[Slot]].Character->ApplyPerception(Snapshot, Inputs[Slot], Perceptions[Slot]);
+    }
+
+    const double Elapsed = FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - StartCycles);
+    AverageAgentSeconds = FMath::Lerp(AverageAgentSeconds, Elapsed / Synced, 0.2);
+
+    for (int32 Slot = 0; Slot < DueScratch.Num(); ++Slot)
+    {
+        FAgent &Agent = Agents[DueScratch[Slot]];
+        Agent.bDeferred = Slot >= Synced;
+
+        // The AI tick this sync was for happens next frame either way
+        const double Interval = Agent.Character->AITickInterval;
+        do
+        {
+            Agent.NextAITickTime += Interval;
+        } while (Agent.NextAITickTime <= Horizon);
+    }
+
+    INC_DWORD_STAT_BY(STAT_MF_AISyncAgents, Synced);
+    INC_DWORD_STAT_BY(STAT_MF_AISyncDeferred, DueScratch.Num() - Synced);
+}
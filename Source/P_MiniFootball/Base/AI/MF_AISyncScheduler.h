@@ -0,0 +1,96 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: MF_AISyncScheduler - Time-sliced SyncBlackboard scheduling for AI players
+ *               Each agent is synced once per AI tick, right before it, with agents spread
+ *               over phase buckets and a per-frame time budget (near-ball agents first)
+ * @Date: 16/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AI/MF_AgentPerception.h"
+#include "MF_AISyncScheduler.generated.h"
+
+class AMF_PlayerCharacter;
+
+/**
+ * UMF_AISyncScheduler
+ *
+ * Owns the AI tick cadence of registered agents: the AI component ticks on a UE component
+ * tick interval (AITickInterval) whose phase is chosen by the scheduler, and the EAIS
+ * internal TickInterval is set to 0 so it evaluates on every component tick.
+ * Knowing when each AI tick will fire, the scheduler syncs that agent's blackboard at the
+ * end of the preceding frame.
+ *
+ * Each batch runs in three passes: target lookups on the game thread, perception over the
+ * frozen snapshot in a ParallelFor, then blackboard writes back on the game thread.
+ *
+ * CVars:
+ *   MF.AI.SyncScheduler     - 0 disables scheduling (agents sync every frame in Tick)
+ *   MF.AI.SyncBuckets       - number of phase buckets per AI interval
+ *   MF.AI.SyncBudgetUs      - per-frame sync budget in microseconds (0 = unlimited)
+ *   MF.AI.ParallelPerception - 0 runs the perception pass serially
+ */
+UCLASS()
+class P_MINIFOOTBALL_API UMF_AISyncScheduler : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /** Get the scheduler for a world context (nullptr if none) */
+    static UMF_AISyncScheduler *Get(const UObject *WorldContextObject);
+
+    /**
+     * Register (or re-register after an AI restart) an agent. Returns false if scheduling
+     * is disabled, in which case the caller keeps syncing every frame.
+     */
+    bool RegisterAgent(AMF_PlayerCharacter *Agent);
+
+    /** Stop scheduling an agent and restore its default AI tick cadence */
+    void UnregisterAgent(AMF_PlayerCharacter *Agent);
+
+    /** True if the agent's blackboard sync is owned by the scheduler */
+    bool IsScheduled(const AMF_PlayerCharacter *Agent) const;
+
+    // ==================== UTickableWorldSubsystem ====================
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+protected:
+    virtual void Deinitialize() override;
+
+private:
+    struct FAgent
+    {
+        TWeakObjectPtr<AMF_PlayerCharacter> Character;
+        int32 Bucket = 0;
+
+        /** World time the agent joins its bucket (AI tick re-enabled); < 0 once joined */
+        double JoinTime = -1.0;
+
+        /** Expected world time of the agent's next AI tick */
+        double NextAITickTime = 0.0;
+
+        /** Missed its sync last time due to budget - goes first next time */
+        bool bDeferred = false;
+    };
+
+    /** Apply the scheduler-owned cadence once the agent's phase comes round */
+    void JoinBucket(FAgent &Agent, double Now);
+
+    int32 PickBucket() const;
+
+    TArray<FAgent> Agents;
+
+    /** Reused scratch for due agents (index into Agents) */
+    TArray<int32> DueScratch;
+
+    /** Per-slot perception inputs/results for the agents synced this frame */
+    TArray<FMF_AgentPerceptionInput> Inputs;
+    TArray<FMF_AgentPerception> Perceptions;
+
+    /** Smoothed cost of one agent sync (seconds), used to fit the budget */
+    double AverageAgentSeconds = 20.0e-6;
+};
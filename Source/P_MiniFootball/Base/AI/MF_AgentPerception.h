@@ -0,0 +1,64 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: MF_AgentPerception - Per-agent perception inputs/results for blackboard sync
+ *               Results are computed from the frozen player snapshot (safe to run in parallel)
+ *               and applied to each agent's blackboard on the game thread
+ * @Date: 16/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Match/MF_FieldLandmarks.h"
+
+class UMF_PitchControlSubsystem;
+
+/**
+ * Game-thread gathered inputs (target provider lookups) for one agent's perception pass
+ */
+struct FMF_AgentPerceptionInput
+{
+    int32 MyIndex = INDEX_NONE;
+    FVector MyLocation = FVector::ZeroVector;
+
+    bool bBallFound = false;
+    FVector BallPos = FVector::ZeroVector;
+
+    bool bGoalFound = false;
+    FVector GoalPos = FVector::ZeroVector;
+
+    /** Shared pitch-control grid (read-only during the perception pass; may be null) */
+    const UMF_PitchControlSubsystem *PitchControl = nullptr;
+
+    /** Field landmarks + zone map (only written during field actor BeginPlay; never null) */
+    const FMF_FieldLandmarks *Landmarks = nullptr;
+};
+
+/**
+ * Per-agent perception results. Pure function of the snapshot + input; no UObject writes.
+ */
+struct FMF_AgentPerception
+{
+    // Nearest opponent
+    float NearestOpponentDist = 99999.0f;
+    int32 NearestOpponentIndex = INDEX_NONE;
+
+    // Striker targeting
+    bool bHasStriker = false;
+    float DistToStriker = 99999.0f;
+    FVector StrikerPos = FVector::ZeroVector;
+
+    // Shot cone
+    bool bHasClearShot = false;
+
+    // Support position
+    FVector SupportPosition = FVector::ZeroVector;
+
+    // Open space near the support position (pitch control, attacking only)
+    bool bHasOpenSpace = false;
+    FVector OpenSpacePosition = FVector::ZeroVector;
+
+    // Pitch zones (relative to my team) I and the ball are in
+    EMF_PitchZone MyZones = EMF_PitchZone::None;
+    EMF_PitchZone BallZones = EMF_PitchZone::None;
+};
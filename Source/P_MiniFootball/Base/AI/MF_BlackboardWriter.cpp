@@ -0,0 +1,187 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: MF_BlackboardWriter - Implementation
+ * @Date: 16/10/2026
+ */
+
+#include "AI/MF_BlackboardWriter.h"
+#include "Core/MF_Stats.h"
+#include "AIComponent.h"
+#include "HAL/IConsoleManager.h"
+
+DEFINE_STAT(STAT_MF_BlackboardWrites);
+DEFINE_STAT(STAT_MF_BlackboardWritesSkipped);
+
+namespace
+{
+    TAutoConsoleVariable<int32> CVarBlackboardDeltaWrites(
+        TEXT("MF.Blackboard.DeltaWrites"),
+        1,
+        TEXT("1 = only write blackboard keys whose value changed (default), 0 = write every staged key each sync (for comparison)."),
+        ECVF_Default);
+
+    struct FBlackboardKeyRegistry
+    {
+        TArray<FString> Names;
+        TArray<float> Epsilons;
+    };
+
+    FBlackboardKeyRegistry &GetBlackboardKeyRegistry()
+    {
+        static FBlackboardKeyRegistry Registry;
+        return Registry;
+    }
+}
+
+// ==================== Keys ====================
+
+FMF_BlackboardKey::FMF_BlackboardKey(const TCHAR *InName, float InEpsilon)
+{
+    FBlackboardKeyRegistry &Registry = GetBlackboardKeyRegistry();
+
+    // Same name registered twice (e.g. from two files) shares one handle
+    Handle = Registry.Names.IndexOfByKey(FString(InName));
+    if (Handle == INDEX_NONE)
+    {
+        Handle = Registry.Names.Add(InName);
+        Registry.Epsilons.Add(InEpsilon);
+    }
+}
+
+const FString &FMF_BlackboardKey::GetName(int32 Handle)
+{
+    return GetBlackboardKeyRegistry().Names[Handle];
+}
+
+// ==================== Staging ====================
+
+FMF_BlackboardWriter::FSlot &FMF_BlackboardWriter::Stage(const FMF_BlackboardKey &Key, EValueType Type)
+{
+    check(Key.Handle != INDEX_NONE);
+
+    if (!Slots.IsValidIndex(Key.Handle))
+    {
+        Slots.SetNum(GetBlackboardKeyRegistry().Names.Num());
+    }
+
+    FSlot &Slot = Slots[Key.Handle];
+    ensureMsgf(Slot.Type == EValueType::None || Slot.Type == Type,
+               TEXT("MF_BlackboardWriter - key '%s' staged with a different type"), *FMF_BlackboardKey::GetName(Key.Handle));
+    Slot.Type = Type;
+
+    if (!Slot.bStaged)
+    {
+        Slot.bStaged = true;
+        StagedHandles.Add(Key.Handle);
+    }
+    return Slot;
+}
+
+void FMF_BlackboardWriter::SetBool(const FMF_BlackboardKey &Key, bool bValue)
+{
+    Stage(Key, EValueType::Bool).bStagedBool = bValue;
+}
+
+void FMF_BlackboardWriter::SetFloat(const FMF_BlackboardKey &Key, float Value)
+{
+    Stage(Key, EValueType::Float).StagedFloat = Value;
+}
+
+void FMF_BlackboardWriter::SetVector(const FMF_BlackboardKey &Key, const FVector &Value)
+{
+    Stage(Key, EValueType::Vector).StagedVector = Value;
+}
+
+void FMF_BlackboardWriter::SetString(const FMF_BlackboardKey &Key, const FString &Value)
+{
+    Stage(Key, EValueType::String).StagedString = Value;
+}
+
+// ==================== Flush ====================
+
+bool FMF_BlackboardWriter::NeedsWrite(const FSlot &Slot, int32 Handle)
+{
+    if (!Slot.bWritten)
+    {
+        return true;
+    }
+
+    const float KeyEpsilon = GetBlackboardKeyRegistry().Epsilons[Handle];
+
+    switch (Slot.Type)
+    {
+    case EValueType::Bool:
+        return Slot.bStagedBool != Slot.bWrittenBool;
+    case EValueType::Float:
+    {
+        const float Epsilon = KeyEpsilon >= 0.0f ? KeyEpsilon : DefaultFloatEpsilon;
+        return FMath::Abs(Slot.StagedFloat - Slot.WrittenFloat) > Epsilon;
+    }
+    case EValueType::Vector:
+    {
+        const float Epsilon = KeyEpsilon >= 0.0f ? KeyEpsilon : DefaultVectorEpsilon;
+        return FVector::DistSquared(Slot.StagedVector, Slot.WrittenVector) > FMath::Square(Epsilon);
+    }
+    case EValueType::String:
+        return !Slot.StagedString.Equals(Slot.WrittenString, ESearchCase::CaseSensitive);
+    default:
+        return false;
+    }
+}
+
+int32 FMF_BlackboardWriter::Flush(UAIComponent *AIComponent)
+{
+    const bool bDeltaOnly = CVarBlackboardDeltaWrites.GetValueOnGameThread() != 0;
+    int32 Writes = 0;
+
+    for (const int32 Handle : StagedHandles)
+    {
+        FSlot &Slot = Slots[Handle];
+        Slot.bStaged = false;
+
+        if (!AIComponent || (bDeltaOnly && !NeedsWrite(Slot, Handle)))
+        {
+            continue;
+        }
+
+        const FString &Name = FMF_BlackboardKey::GetName(Handle);
+        switch (Slot.Type)
+        {
+        case EValueType::Bool:
+            AIComponent->SetBlackboardBool(Name, Slot.bStagedBool);
+            Slot.bWrittenBool = Slot.bStagedBool;
+            break;
+        case EValueType::Float:
+            AIComponent->SetBlackboardFloat(Name, Slot.StagedFloat);
+            Slot.WrittenFloat = Slot.StagedFloat;
+            break;
+        case EValueType::Vector:
+            AIComponent->SetBlackboardVector(Name, Slot.StagedVector);
+            Slot.WrittenVector = Slot.StagedVector;
+            break;
+        case EValueType::String:
+            AIComponent->SetBlackboardValue(Name, FBlackboardValue(Slot.StagedString));
+            Slot.WrittenString = Slot.StagedString;
+            break;
+        default:
+            continue;
+        }
+
+        Slot.bWritten = true;
+        ++Writes;
+    }
+
+    INC_DWORD_STAT_BY(STAT_MF_BlackboardWrites, Writes);
+    INC_DWORD_STAT_BY(STAT_MF_BlackboardWritesSkipped, StagedHandles.Num() - Writes);
+
+    StagedHandles.Reset();
+    return Writes;
+}
+
+void FMF_BlackboardWriter::Invalidate()
+{
+    for (FSlot &Slot : Slots)
+    {
+        Slot.bWritten = false;
+    }
+}
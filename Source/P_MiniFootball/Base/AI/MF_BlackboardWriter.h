@@ -0,0 +1,92 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: MF_BlackboardWriter - Change-detecting, batched writer for EAIS blackboards
+ *               Keys are interned to handles once; values are staged per frame and only
+ *               the ones that moved past their epsilon are written on Flush()
+ * @Date: 16/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UAIComponent;
+
+/**
+ * FMF_BlackboardKey
+ * Interned blackboard key. Declare once (file-scope static) and reuse:
+ *   static const FMF_BlackboardKey Key_HasBall(TEXT("HasBall"));
+ *
+ * Epsilon applies to Float (absolute) and Vector (distance) values; a negative
+ * value uses the writer's per-type default.
+ */
+struct P_MINIFOOTBALL_API FMF_BlackboardKey
+{
+    explicit FMF_BlackboardKey(const TCHAR *InName, float InEpsilon = -1.0f);
+
+    int32 Handle = INDEX_NONE;
+
+    /** Name registered for a handle */
+    static const FString &GetName(int32 Handle);
+};
+
+/**
+ * FMF_BlackboardWriter
+ * Owned per character. Stage values with Set*(), then Flush() once at the end of
+ * the sync pass. Call Invalidate() whenever the blackboard may have been cleared
+ * (StartAI/ResetAI/profile swap) so the next Flush() rewrites every key.
+ */
+class P_MINIFOOTBALL_API FMF_BlackboardWriter
+{
+public:
+    /** Default epsilons when a key does not specify one */
+    static constexpr float DefaultFloatEpsilon = 0.01f;
+    static constexpr float DefaultVectorEpsilon = 1.0f; // cm
+
+    void SetBool(const FMF_BlackboardKey &Key, bool bValue);
+    void SetFloat(const FMF_BlackboardKey &Key, float Value);
+    void SetVector(const FMF_BlackboardKey &Key, const FVector &Value);
+    void SetString(const FMF_BlackboardKey &Key, const FString &Value);
+
+    /** Write staged values that changed to AIComponent. Returns the number of writes issued. */
+    int32 Flush(UAIComponent *AIComponent);
+
+    /** Forget last written values so every staged key is written on the next Flush() */
+    void Invalidate();
+
+private:
+    enum class EValueType : uint8
+    {
+        None,
+        Bool,
+        Float,
+        Vector,
+        String
+    };
+
+    struct FSlot
+    {
+        EValueType Type = EValueType::None;
+        bool bStaged = false;
+        bool bWritten = false;
+
+        bool bStagedBool = false;
+        bool bWrittenBool = false;
+        float StagedFloat = 0.0f;
+        float WrittenFloat = 0.0f;
+        FVector StagedVector = FVector::ZeroVector;
+        FVector WrittenVector = FVector::ZeroVector;
+        FString StagedString;
+        FString WrittenString;
+    };
+
+    FSlot &Stage(const FMF_BlackboardKey &Key, EValueType Type);
+
+    /** True if the staged value differs from the written one (or was never written) */
+    static bool NeedsWrite(const FSlot &Slot, int32 Handle);
+
+    TArray<FSlot> Slots;
+
+    /** Handles staged since the last Flush(), in staging order */
+    TArray<int32> StagedHandles;
+};
@@ -0,0 +1,162 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: MF_LaneClearance - Implementation
+ * @Date: 16/10/2026
+ */
+
+#include "AI/MF_LaneClearance.h"
+#include "Core/MF_PlayerSnapshotSubsystem.h"
+#include "Core/MF_SpatialGrid.h"
+#include "Math/VectorRegister.h"
+
+namespace
+{
+    /** Padding position: far enough that it never blocks, never is nearest, and adds no risk */
+    constexpr float LaneSentinel = 1.0e7f;
+
+    float HorizontalMin(const VectorRegister4Float &Vec)
+    {
+        alignas(16) float Lanes[4];
+        VectorStoreAligned(Vec, Lanes);
+        return FMath::Min(FMath::Min(Lanes[0], Lanes[1]), FMath::Min(Lanes[2], Lanes[3]));
+    }
+
+    float HorizontalSum(const VectorRegister4Float &Vec)
+    {
+        alignas(16) float Lanes[4];
+        VectorStoreAligned(Vec, Lanes);
+        return (Lanes[0] + Lanes[1]) + (Lanes[2] + Lanes[3]);
+    }
+}
+
+// ==================== FMF_LaneOpponents ====================
+
+void FMF_LaneOpponents::Reset()
+{
+    X.Reset();
+    Y.Reset();
+    Count = 0;
+}
+
+void FMF_LaneOpponents::Add(const FVector &Position)
+{
+    // Overwrite the first padding slot, or grow by a whole register of sentinels
+    if (Count == X.Num())
+    {
+        X.AddUninitialized(4);
+        Y.AddUninitialized(4);
+        for (int32 Slot = Count; Slot < Count + 4; ++Slot)
+        {
+            X[Slot] = LaneSentinel;
+            Y[Slot] = LaneSentinel;
+        }
+    }
+
+    X[Count] = static_cast<float>(Position.X);
+    Y[Count] = static_cast<float>(Position.Y);
+    ++Count;
+}
+
+void FMF_LaneOpponents::AddFromSnapshot(const FMF_PlayerSnapshot &Snapshot, uint8 TeamMask, int32 ExcludeIndex)
+{
+    for (int32 Index = 0; Index < Snapshot.Num(); ++Index)
+    {
+        if (Index != ExcludeIndex && (TeamMask & MF_TeamMask::Only(Snapshot.Teams[Index])) != 0)
+        {
+            Add(Snapshot.Positions[Index]);
+        }
+    }
+}
+
+// ==================== Kernel ====================
+
+void MF_LaneClearance::Evaluate(const FVector &Origin, TConstArrayView<FVector> LaneEnds, const FMF_LaneOpponents &Opponents,
+                                TArrayView<FMF_LaneClearance> OutResults, float RiskRadius)
+{
+    check(LaneEnds.Num() == OutResults.Num());
+
+    const int32 NumPadded = Opponents.NumPadded();
+    const float *OppX = Opponents.X.GetData();
+    const float *OppY = Opponents.Y.GetData();
+
+    const VectorRegister4Float Zero = VectorZeroFloat();
+    const VectorRegister4Float One = VectorOneFloat();
+    const VectorRegister4Float Big = VectorSetFloat1(MAX_flt);
+    const VectorRegister4Float Tiny = VectorSetFloat1(UE_KINDA_SMALL_NUMBER);
+    const VectorRegister4Float InvRisk = VectorSetFloat1(1.0f / FMath::Max(RiskRadius, 1.0f));
+    const VectorRegister4Float OriginX = VectorSetFloat1(static_cast<float>(Origin.X));
+    const VectorRegister4Float OriginY = VectorSetFloat1(static_cast<float>(Origin.Y));
+
+    for (int32 Lane = 0; Lane < LaneEnds.Num(); ++Lane)
+    {
+        const float DirX = static_cast<float>(LaneEnds[Lane].X - Origin.X);
+        const float DirY = static_cast<float>(LaneEnds[Lane].Y - Origin.Y);
+        const float LenSq = DirX * DirX + DirY * DirY;
+
+        const VectorRegister4Float Dx = VectorSetFloat1(DirX);
+        const VectorRegister4Float Dy = VectorSetFloat1(DirY);
+        const VectorRegister4Float LaneLenSq = VectorSetFloat1(LenSq);
+        const VectorRegister4Float InvLenSq = VectorSetFloat1(LenSq > UE_KINDA_SMALL_NUMBER ? 1.0f / LenSq : 0.0f);
+        const VectorRegister4Float EndX = VectorSetFloat1(static_cast<float>(LaneEnds[Lane].X));
+        const VectorRegister4Float EndY = VectorSetFloat1(static_cast<float>(LaneEnds[Lane].Y));
+
+        VectorRegister4Float MinClearSq = Big;
+        VectorRegister4Float MinRatio = Big;
+        VectorRegister4Float MinEndSq = Big;
+        VectorRegister4Float Risk = Zero;
+
+        for (int32 Base = 0; Base < NumPadded; Base += 4)
+        {
+            const VectorRegister4Float Ox = VectorLoad(OppX + Base);
+            const VectorRegister4Float Oy = VectorLoad(OppY + Base);
+
+            // Opponent relative to the origin
+            const VectorRegister4Float Wx = VectorSubtract(Ox, OriginX);
+            const VectorRegister4Float Wy = VectorSubtract(Oy, OriginY);
+            const VectorRegister4Float Dot = VectorMultiplyAdd(Wx, Dx, VectorMultiply(Wy, Dy));
+            const VectorRegister4Float Cross = VectorAbs(VectorSubtract(VectorMultiply(Wx, Dy), VectorMultiply(Wy, Dx)));
+            const VectorRegister4Float DistSq = VectorMultiplyAdd(Wx, Wx, VectorMultiply(Wy, Wy));
+
+            // Closest point on the segment
+            const VectorRegister4Float T = VectorMin(VectorMax(VectorMultiply(Dot, InvLenSq), Zero), One);
+            const VectorRegister4Float Cx = VectorNegateMultiplyAdd(T, Dx, Wx);
+            const VectorRegister4Float Cy = VectorNegateMultiplyAdd(T, Dy, Wy);
+            const VectorRegister4Float ClearSq = VectorMultiplyAdd(Cx, Cx, VectorMultiply(Cy, Cy));
+            MinClearSq = VectorMin(MinClearSq, ClearSq);
+
+            // Angular clearance: only opponents ahead of the origin and nearer than the lane end
+            const VectorRegister4Float InFront = VectorBitwiseAnd(VectorCompareGT(Dot, Zero), VectorCompareLT(DistSq, LaneLenSq));
+            const VectorRegister4Float Ratio = VectorDivide(Cross, VectorMax(Dot, Tiny));
+            MinRatio = VectorMin(MinRatio, VectorSelect(InFront, Ratio, Big));
+
+            // Marking at the lane end
+            const VectorRegister4Float Ex = VectorSubtract(Ox, EndX);
+            const VectorRegister4Float Ey = VectorSubtract(Oy, EndY);
+            MinEndSq = VectorMin(MinEndSq, VectorMultiplyAdd(Ex, Ex, VectorMultiply(Ey, Ey)));
+
+            // Interception risk: linear falloff with distance to the lane
+            const VectorRegister4Float Reach = VectorSubtract(One, VectorMultiply(VectorSqrt(ClearSq), InvRisk));
+            Risk = VectorAdd(Risk, VectorMax(Reach, Zero));
+        }
+
+        FMF_LaneClearance &Result = OutResults[Lane];
+        if (Opponents.Num() == 0)
+        {
+            Result = FMF_LaneClearance();
+            continue;
+        }
+
+        Result.MinClearance = FMath::Sqrt(HorizontalMin(MinClearSq));
+        Result.MinAngularClearance = HorizontalMin(MinRatio);
+        Result.EndClearance = FMath::Sqrt(HorizontalMin(MinEndSq));
+        Result.InterceptRisk = HorizontalSum(Risk);
+    }
+}
+
+FMF_LaneClearance MF_LaneClearance::EvaluateLane(const FVector &Origin, const FVector &LaneEnd, const FMF_LaneOpponents &Opponents,
+                                                 float RiskRadius)
+{
+    FMF_LaneClearance Result;
+    Evaluate(Origin, MakeArrayView(&LaneEnd, 1), Opponents, MakeArrayView(&Result, 1), RiskRadius);
+    return Result;
+}
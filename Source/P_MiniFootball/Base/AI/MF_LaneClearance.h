@@ -0,0 +1,91 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: MF_LaneClearance - Batched segment-vs-opponent clearance kernel
+ *               Tests every candidate lane (pass, shot, through ball) against every opponent,
+ *               four opponents per SIMD register, and reports clearance + interception risk
+ * @Date: 16/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FMF_PlayerSnapshot;
+
+/**
+ * Half-angle of the "lane blocked" cones, as tan(half-angle).
+ * An opponent blocks a lane when it is in front of the origin, nearer than the lane end,
+ * and its perpendicular/along ratio is below the cone value.
+ */
+namespace MF_LaneCone
+{
+    /** ~25.8 deg (cos = 0.9) - passing lane */
+    constexpr float Pass = 0.4843f;
+
+    /** ~31.8 deg (cos = 0.85) - shot towards goal */
+    constexpr float Shot = 0.6197f;
+}
+
+/**
+ * FMF_LaneOpponents
+ * Opponent positions on the XY plane in structure-of-arrays form, padded to a
+ * multiple of four with far-away sentinels so the kernel never needs a scalar tail.
+ */
+struct P_MINIFOOTBALL_API FMF_LaneOpponents
+{
+    void Reset();
+    void Add(const FVector &Position);
+
+    /** Add every snapshot player whose team is in TeamMask (see MF_TeamMask), except ExcludeIndex */
+    void AddFromSnapshot(const FMF_PlayerSnapshot &Snapshot, uint8 TeamMask, int32 ExcludeIndex = INDEX_NONE);
+
+    /** Real opponent count (without padding) */
+    int32 Num() const { return Count; }
+
+    /** Padded length of X/Y (multiple of 4) */
+    int32 NumPadded() const { return X.Num(); }
+
+    TArray<float, TInlineAllocator<32>> X;
+    TArray<float, TInlineAllocator<32>> Y;
+
+private:
+    int32 Count = 0;
+};
+
+/**
+ * Per-lane result. All distances are 2D (cm).
+ */
+struct FMF_LaneClearance
+{
+    /** Distance from the lane segment to the closest opponent */
+    float MinClearance = MAX_flt;
+
+    /** Smallest perpendicular/along ratio among opponents ahead of the origin and nearer than the lane end */
+    float MinAngularClearance = MAX_flt;
+
+    /** Distance from the lane end (receiver / target) to the closest opponent */
+    float EndClearance = MAX_flt;
+
+    /** Sum over opponents of saturate(1 - clearance / RiskRadius); 0 = nobody near the lane */
+    float InterceptRisk = 0.0f;
+
+    /** True if an opponent sits inside the cone of half-angle atan(ConeTan) */
+    bool IsBlocked(float ConeTan) const { return MinAngularClearance < ConeTan; }
+};
+
+namespace MF_LaneClearance
+{
+    /** Default radius for InterceptRisk (cm) - roughly a tackle lunge */
+    constexpr float DefaultRiskRadius = 300.0f;
+
+    /**
+     * Evaluate lanes Origin -> LaneEnds[i] against all Opponents.
+     * OutResults must have the same length as LaneEnds.
+     */
+    P_MINIFOOTBALL_API void Evaluate(const FVector &Origin, TConstArrayView<FVector> LaneEnds, const FMF_LaneOpponents &Opponents,
+                                     TArrayView<FMF_LaneClearance> OutResults, float RiskRadius = DefaultRiskRadius);
+
+    /** Single-lane convenience wrapper */
+    P_MINIFOOTBALL_API FMF_LaneClearance EvaluateLane(const FVector &Origin, const FVector &LaneEnd, const FMF_LaneOpponents &Opponents,
+                                                      float RiskRadius = DefaultRiskRadius);
+}
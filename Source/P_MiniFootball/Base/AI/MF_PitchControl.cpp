@@ -0,0 +1,240 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: MF_PitchControl - Implementation
+ * @Date: 16/10/2026
+ */
+
+#include "AI/MF_PitchControl.h"
+#include "Core/MF_PlayerSnapshotSubsystem.h"
+#include "Core/MF_Stats.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_CYCLE_STAT(TEXT("Pitch Control Update"), STAT_MF_PitchControl, STATGROUP_MiniFootball);
+
+namespace
+{
+    TAutoConsoleVariable<int32> CVarPitchControl(
+        TEXT("MF.AI.PitchControl"),
+        1,
+        TEXT("1 = maintain the per-team pitch-control grid used for AI open-space positioning (default).\n")
+            TEXT("0 = disable; agents fall back to role support positions."),
+        ECVF_Default);
+
+    TAutoConsoleVariable<float> CVarPitchControlSweep(
+        TEXT("MF.AI.PitchControlSweep"),
+        0.1f,
+        TEXT("Seconds for one full incremental sweep of the pitch-control grid (default matches the AI tick interval)."),
+        ECVF_Default);
+
+    /** Stunned players start moving this much later (seconds) */
+    constexpr float StunnedDelay = 1.0f;
+}
+
+UMF_PitchControlSubsystem *UMF_PitchControlSubsystem::Get(const UObject *WorldContextObject)
+{
+    const UWorld *World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    return World ? World->GetSubsystem<UMF_PitchControlSubsystem>() : nullptr;
+}
+
+TStatId UMF_PitchControlSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UMF_PitchControlSubsystem, STATGROUP_Tickables);
+}
+
+void UMF_PitchControlSubsystem::Initialize(FSubsystemCollectionBase &Collection)
+{
+    Super::Initialize(Collection);
+
+    // Field width runs along X, length along Y
+    const FVector2D HalfExtent(MF_Constants::FieldWidth / 2.0f, MF_Constants::FieldLength / 2.0f);
+    Min = -HalfExtent;
+    CellsX = FMath::CeilToInt32(MF_Constants::FieldWidth / CellSize);
+    CellsY = FMath::CeilToInt32(MF_Constants::FieldLength / CellSize);
+
+    for (TArray<float> &Times : TimeToReach)
+    {
+        Times.Init(MAX_flt, CellsX * CellsY);
+    }
+}
+
+// ==================== Update ====================
+
+void UMF_PitchControlSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    const UWorld *World = GetWorld();
+    if (!World || World->GetNetMode() == NM_Client || CVarPitchControl.GetValueOnGameThread() == 0)
+    {
+        bHasData = false;
+        return;
+    }
+
+    UMF_PlayerSnapshotSubsystem *Snapshots = UMF_PlayerSnapshotSubsystem::Get(this);
+    if (!Snapshots)
+    {
+        return;
+    }
+
+    const FMF_PlayerSnapshot &Snapshot = Snapshots->GetSnapshot();
+    if (Snapshot.Num() == 0)
+    {
+        return;
+    }
+
+    SCOPE_CYCLE_COUNTER(STAT_MF_PitchControl);
+
+    // First sweep is done in one go so queries never see a half-built grid
+    if (!bHasData)
+    {
+        UpdateRows(Snapshot, 0, CellsY);
+        NextRow = 0;
+        RowCarry = 0.0f;
+        bHasData = true;
+        return;
+    }
+
+    const float SweepSeconds = FMath::Max(CVarPitchControlSweep.GetValueOnGameThread(), UE_KINDA_SMALL_NUMBER);
+    RowCarry += CellsY * DeltaTime / SweepSeconds;
+    int32 RowsToUpdate = FMath::Min(FMath::FloorToInt32(RowCarry), CellsY);
+    RowCarry -= RowsToUpdate;
+
+    while (RowsToUpdate > 0)
+    {
+        const int32 Count = FMath::Min(RowsToUpdate, CellsY - NextRow);
+        UpdateRows(Snapshot, NextRow, Count);
+        NextRow = (NextRow + Count) % CellsY;
+        RowsToUpdate -= Count;
+    }
+}
+
+void UMF_PitchControlSubsystem::UpdateRows(const FMF_PlayerSnapshot &Snapshot, int32 FirstRow, int32 NumRows)
+{
+    // Per-player start point (after the reaction delay) and head start, per team
+    struct FRunner
+    {
+        float X;
+        float Y;
+        float Delay;
+    };
+    TArray<FRunner, TInlineAllocator<16>> Runners[2];
+
+    for (int32 Index = 0; Index < Snapshot.Num(); ++Index)
+    {
+        const int32 Slot = TeamSlot(Snapshot.Teams[Index]);
+        if (Slot == INDEX_NONE)
+        {
+            continue;
+        }
+
+        const FVector Start = Snapshot.Positions[Index] + Snapshot.Velocities[Index] * ReactionTime;
+        const float Delay = ReactionTime + (Snapshot.Stunned[Index] ? StunnedDelay : 0.0f);
+        Runners[Slot].Add({static_cast<float>(Start.X), static_cast<float>(Start.Y), Delay});
+    }
+
+    const float InvSpeed = 1.0f / MF_Constants::SprintSpeed;
+
+    for (int32 Y = FirstRow; Y < FirstRow + NumRows; ++Y)
+    {
+        const float CellY = static_cast<float>(Min.Y) + (Y + 0.5f) * CellSize;
+        for (int32 X = 0; X < CellsX; ++X)
+        {
+            const float CellX = static_cast<float>(Min.X) + (X + 0.5f) * CellSize;
+            const int32 Cell = Y * CellsX + X;
+
+            for (int32 Slot = 0; Slot < 2; ++Slot)
+            {
+                float Best = MAX_flt;
+                for (const FRunner &Runner : Runners[Slot])
+                {
+                    const float Dist = FMath::Sqrt(FMath::Square(CellX - Runner.X) + FMath::Square(CellY - Runner.Y));
+                    Best = FMath::Min(Best, Runner.Delay + Dist * InvSpeed);
+                }
+                TimeToReach[Slot][Cell] = Best;
+            }
+        }
+    }
+}
+
+// ==================== Queries ====================
+
+int32 UMF_PitchControlSubsystem::CellIndex(const FVector &Position) const
+{
+    const int32 X = FMath::Clamp(FMath::FloorToInt32((Position.X - Min.X) / CellSize), 0, CellsX - 1);
+    const int32 Y = FMath::Clamp(FMath::FloorToInt32((Position.Y - Min.Y) / CellSize), 0, CellsY - 1);
+    return Y * CellsX + X;
+}
+
+FVector UMF_PitchControlSubsystem::CellCenter(int32 X, int32 Y) const
+{
+    return FVector(Min.X + (X + 0.5f) * CellSize, Min.Y + (Y + 0.5f) * CellSize, MF_Constants::GroundZ);
+}
+
+float UMF_PitchControlSubsystem::ControlAt(int32 Slot, int32 Cell) const
+{
+    const float Mine = TimeToReach[Slot][Cell];
+    const float Theirs = TimeToReach[1 - Slot][Cell];
+    if (Mine == MAX_flt || Theirs == MAX_flt)
+    {
+        return Mine == Theirs ? 0.5f : (Mine < Theirs ? 1.0f : 0.0f);
+    }
+    return 1.0f / (1.0f + FMath::Exp((Mine - Theirs) / ControlScale));
+}
+
+float UMF_PitchControlSubsystem::GetTimeToReach(EMF_TeamID Team, const FVector &Position) const
+{
+    const int32 Slot = TeamSlot(Team);
+    return (bHasData && Slot != INDEX_NONE) ? TimeToReach[Slot][CellIndex(Position)] : MAX_flt;
+}
+
+float UMF_PitchControlSubsystem::GetControl(EMF_TeamID Team, const FVector &Position) const
+{
+    const int32 Slot = TeamSlot(Team);
+    return (bHasData && Slot != INDEX_NONE) ? ControlAt(Slot, CellIndex(Position)) : 0.5f;
+}
+
+bool UMF_PitchControlSubsystem::FindBestOpenSpace(EMF_TeamID Team, const FVector &Near, float SearchRadius, FVector &OutPosition) const
+{
+    const int32 Slot = TeamSlot(Team);
+    if (!bHasData || Slot == INDEX_NONE)
+    {
+        return false;
+    }
+
+    // Bias towards Near: a cell at the edge of the search loses this much control score
+    constexpr float DistancePenalty = 0.25f;
+
+    const int32 CenterCell = CellIndex(Near);
+    const int32 CX = CenterCell % CellsX;
+    const int32 CY = CenterCell / CellsX;
+    const int32 Reach = FMath::CeilToInt32(SearchRadius / CellSize);
+    const float RadiusSq = FMath::Square(SearchRadius);
+    const float InvRadius = 1.0f / FMath::Max(SearchRadius, 1.0f);
+
+    float BestScore = 0.5f; // must be at least uncontested
+    bool bFound = false;
+
+    for (int32 Y = FMath::Max(CY - Reach, 0); Y <= FMath::Min(CY + Reach, CellsY - 1); ++Y)
+    {
+        for (int32 X = FMath::Max(CX - Reach, 0); X <= FMath::Min(CX + Reach, CellsX - 1); ++X)
+        {
+            const FVector Center = CellCenter(X, Y);
+            const float DistSq = FVector::DistSquared2D(Center, Near);
+            if (DistSq > RadiusSq)
+            {
+                continue;
+            }
+
+            const float Score = ControlAt(Slot, Y * CellsX + X) - DistancePenalty * FMath::Sqrt(DistSq) * InvRadius;
+            if (Score > BestScore)
+            {
+                BestScore = Score;
+                OutPosition = Center;
+                bFound = true;
+            }
+        }
+    }
+
+    return bFound;
+}
@@ -0,0 +1,96 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: MF_PitchControl - Coarse per-team pitch-control grid for AI positioning
+ *               Each 2m cell holds each team's estimated time to reach it; rows are refreshed
+ *               incrementally from the player snapshot so a full sweep spans one AI tick
+ * @Date: 16/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Core/MF_Types.h"
+#include "MF_PitchControl.generated.h"
+
+struct FMF_PlayerSnapshot;
+
+/**
+ * UMF_PitchControlSubsystem
+ *
+ * Shared by every agent instead of each agent scanning all players for open space.
+ * Time-to-reach model: position projected along current velocity for a reaction delay,
+ * then a straight sprint to the cell centre. Control for a team is a logistic of the
+ * time difference to the other team (0.5 = contested).
+ *
+ * Server only (AI runs on the server). Readers are safe from parallel perception
+ * passes: the grid only changes in this subsystem's game-thread Tick.
+ *
+ * CVars:
+ *   MF.AI.PitchControl      - 0 disables updates (queries report no open space)
+ *   MF.AI.PitchControlSweep - seconds for one full sweep of the grid
+ */
+UCLASS()
+class P_MINIFOOTBALL_API UMF_PitchControlSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /** Cell size (cm) */
+    static constexpr float CellSize = 200.0f;
+
+    /** Reaction delay before a player can change course (seconds) */
+    static constexpr float ReactionTime = 0.25f;
+
+    /** Logistic scale for control (seconds of time advantage for ~73% control) */
+    static constexpr float ControlScale = 0.5f;
+
+    /** Get the subsystem for a world context (nullptr if none) */
+    static UMF_PitchControlSubsystem *Get(const UObject *WorldContextObject);
+
+    /** True once every cell has been computed at least once */
+    bool HasData() const { return bHasData; }
+
+    /** Estimated seconds for Team's quickest player to reach Position (MAX_flt if unknown) */
+    float GetTimeToReach(EMF_TeamID Team, const FVector &Position) const;
+
+    /** Team's control of Position in [0, 1] (0.5 if unknown) */
+    float GetControl(EMF_TeamID Team, const FVector &Position) const;
+
+    /**
+     * Cell centre within SearchRadius of Near that Team controls best, lightly biased
+     * towards Near. Returns false if there is no data or no cell is Team-controlled.
+     */
+    bool FindBestOpenSpace(EMF_TeamID Team, const FVector &Near, float SearchRadius, FVector &OutPosition) const;
+
+    int32 GetCellCountX() const { return CellsX; }
+    int32 GetCellCountY() const { return CellsY; }
+
+    // ==================== UTickableWorldSubsystem ====================
+    virtual void Initialize(FSubsystemCollectionBase &Collection) override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+private:
+    /** Recompute rows [FirstRow, FirstRow + NumRows) from the snapshot */
+    void UpdateRows(const FMF_PlayerSnapshot &Snapshot, int32 FirstRow, int32 NumRows);
+
+    static int32 TeamSlot(EMF_TeamID Team) { return Team == EMF_TeamID::TeamA ? 0 : (Team == EMF_TeamID::TeamB ? 1 : INDEX_NONE); }
+
+    int32 CellIndex(const FVector &Position) const;
+    FVector CellCenter(int32 X, int32 Y) const;
+    float ControlAt(int32 Slot, int32 Cell) const;
+
+    FVector2D Min = FVector2D::ZeroVector;
+    int32 CellsX = 0;
+    int32 CellsY = 0;
+
+    /** Per team (TeamA, TeamB): min time to reach each cell, row-major */
+    TArray<float> TimeToReach[2];
+
+    /** Next row the incremental sweep refreshes, and fractional rows owed from previous ticks */
+    int32 NextRow = 0;
+    float RowCarry = 0.0f;
+
+    bool bHasData = false;
+};
@@ -3,15 +3,53 @@
  * @Description: MF_Ball - Implementation
  *               Math-based ball physics (NO UE Physics)
  *               Full network replication for Listen Server and Dedicated Server
+ *               (send-on-drift server, dead-reckoning clients)
  * @Date: 07/12/2025
  */
 
 #include "Ball/MF_Ball.h"
 #include "Player/MF_PlayerCharacter.h"
+#include "Core/MF_PlayerSnapshotSubsystem.h"
+#include "Match/MF_FieldLandmarks.h"
+#include "Match/MF_Goal.h"
 #include "Components/SphereComponent.h"
 #include "Components/StaticMeshComponent.h"
+#include "GameFramework/GameStateBase.h"
+#include "Core/MF_Stats.h"
+#include "Settings/MF_NetworkSettings.h"
+#include "HAL/IConsoleManager.h"
 #include "Net/UnrealNetwork.h"
-#include "EngineUtils.h" // For TActorIterator
+#include "Net/Core/PushModel/PushModel.h"
+
+DEFINE_STAT(STAT_MF_BallTransformCommits);
+DECLARE_CYCLE_STAT(TEXT("Ball Transform Commit"), STAT_MF_BallTransformCommit, STATGROUP_MiniFootball);
+
+namespace
+{
+    TAutoConsoleVariable<int32> CVarBallLegacyTransform(
+        TEXT("MF.Ball.LegacyTransform"),
+        0,
+        TEXT("1 = old ball transform path for A/B timing: pickup sphere generates overlaps, location and spin are separate moves, spin runs on dedicated servers too.\n")
+            TEXT("0 = one teleport move per frame with no overlap updates (default). The overlap setting applies from the next ball state change."),
+        ECVF_Default);
+
+    TAutoConsoleVariable<int32> CVarBallSleep(
+        TEXT("MF.Ball.Sleep"),
+        1,
+        TEXT("1 = a loose ball at rest with no player nearby stops ticking and goes net dormant until a player comes near, it is kicked or reset (default).\n")
+            TEXT("0 = the ball always ticks and replicates."),
+        ECVF_Default);
+
+    /** Local rotation for AngularVelocity (rad/s) over DeltaTime */
+    FQuat MF_SpinDelta(const FVector &AngularVelocity, float DeltaTime)
+    {
+        return FRotator(
+                   FMath::RadiansToDegrees(AngularVelocity.Y * DeltaTime),
+                   FMath::RadiansToDegrees(AngularVelocity.Z * DeltaTime),
+                   FMath::RadiansToDegrees(AngularVelocity.X * DeltaTime))
+            .Quaternion();
+    }
+}
 
 AMF_Ball::AMF_Ball()
 {
@@ -25,7 +63,11 @@ AMF_Ball::AMF_Ball()
     CollisionSphere->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
     CollisionSphere->SetCollisionObjectType(ECollisionChannel::ECC_WorldDynamic);
     CollisionSphere->SetCollisionResponseToAllChannels(ECollisionResponse::ECR_Overlap);
-    CollisionSphere->SetGenerateOverlapEvents(true);
+
+    // Pickup comes from the player snapshot (CheckForNearbyPlayers), so moving the ball
+    // never has to refresh overlaps or its physics volume
+    CollisionSphere->SetGenerateOverlapEvents(false);
+    CollisionSphere->SetShouldUpdatePhysicsVolume(false);
 
     // NO PHYSICS - we do our own math
     CollisionSphere->SetSimulatePhysics(false);
@@ -64,9 +106,26 @@ void AMF_Ball::GetLifetimeReplicatedProps(TArray<FLifetimeProperty> &OutLifetime
 {
     Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
-    DOREPLIFETIME(AMF_Ball, CurrentBallState);
-    DOREPLIFETIME(AMF_Ball, CurrentPossessor);
-    DOREPLIFETIME(AMF_Ball, ReplicatedPhysics);
+    // Push model: only properties marked dirty on the server are compared
+    FDoRepLifetimeParams Params;
+    Params.bIsPushBased = true;
+
+    DOREPLIFETIME_WITH_PARAMS_FAST(AMF_Ball, CurrentBallState, Params);
+    DOREPLIFETIME_WITH_PARAMS_FAST(AMF_Ball, ReplicatedPhysics, Params);
+}
+
+float AMF_Ball::GetNetPriority(const FVector &ViewPos, const FVector &ViewDir, AActor *Viewer, AActor *ViewTarget,
+                               UActorChannel *InChannel, float Time, bool bLowBandwidth)
+{
+    const UMF_NetworkSettings *Settings = UMF_NetworkSettings::Get();
+
+    // Every viewer needs the ball, so no view-cone/distance weighting
+    float Priority = NetPriority * Time * Settings->BallPriorityScale;
+    if (Settings->bAdaptiveNetUpdateFrequency)
+    {
+        Priority *= Settings->GetTier(NetActivity).PriorityScale;
+    }
+    return Priority;
 }
 
 void AMF_Ball::BeginPlay()
@@ -81,9 +140,20 @@ void AMF_Ball::BeginPlay()
         CollisionSphere->OnComponentBeginOverlap.AddDynamic(this, &AMF_Ball::OnBallOverlap);
     }
 
-    // Initialize interpolation
-    LastReplicatedPosition = GetActorLocation();
-    InterpolationTarget = LastReplicatedPosition;
+    if (UMF_PlayerSnapshotSubsystem *Snapshots = UMF_PlayerSnapshotSubsystem::Get(this))
+    {
+        Snapshots->RegisterBall(this);
+    }
+}
+
+void AMF_Ball::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UMF_PlayerSnapshotSubsystem *Snapshots = UMF_PlayerSnapshotSubsystem::Get(this))
+    {
+        Snapshots->UnregisterBall(this);
+    }
+
+    Super::EndPlay(EndPlayReason);
 }
 
 void AMF_Ball::Tick(float DeltaTime)
@@ -117,25 +187,26 @@ void AMF_Ball::Tick(float DeltaTime)
         case EMF_BallState::Loose:
         case EMF_BallState::InFlight:
             UpdatePhysics(DeltaTime);
-            // Also check for nearby players who can pick up the ball (backup for overlap events)
+            // Pickup from the player snapshot (the sphere no longer generates overlaps)
             CheckForNearbyPlayers();
+            UpdateSleep(DeltaTime);
             break;
         case EMF_BallState::Possessed:
+            bHasSimState = false;
             UpdatePossessedPosition();
             break;
         case EMF_BallState::OutOfBounds:
             // Ball is stationary, waiting for reset
+            bHasSimState = false;
             break;
         }
 
-        // Update replicated physics data
-        ReplicatedPhysics.Location = GetActorLocation();
-        ReplicatedPhysics.Velocity = Velocity;
-        ReplicatedPhysics.ServerTimestamp = GetWorld()->GetTimeSeconds();
+        PublishPhysicsState();
+        UpdateNetActivity();
     }
     else
     {
-        // Client: Interpolate towards replicated position
+        // Client: Extrapolate the replicated state
         ClientInterpolate(DeltaTime);
     }
 }
@@ -149,20 +220,12 @@ void AMF_Ball::Kick(FVector Direction, float Power, bool bAddHeight)
         return;
     }
 
-    // Normalize direction
-    Direction.Normalize();
+    WakeUp();
 
-    // Calculate kick velocity
-    Velocity = Direction * Power;
-
-    // Add some height for shots
-    if (bAddHeight)
-    {
-        Velocity.Z += Power * 0.3f; // Add ~30% power as upward velocity
-    }
-
-    // Add spin (simplified)
-    AngularVelocity = FVector::CrossProduct(FVector::UpVector, Direction) * (Power / 100.0f);
+    // Launch velocity, spin and ~30% power upward for shots (shared with pass prediction)
+    const FMF_BallPhysicsState Launch = MF_BallPhysics::MakeKick(GetActorLocation(), Direction, Power, bAddHeight);
+    Velocity = Launch.Velocity;
+    AngularVelocity = Launch.AngularVelocity;
 
     // Track kick time for last-kicker pickup lockout
     if (UWorld* World = GetWorld())
@@ -179,10 +242,11 @@ void AMF_Ball::Kick(FVector Direction, float Power, bool bAddHeight)
 
     // Set state to in flight
     SetBallState(EMF_BallState::InFlight);
-    bIsGrounded = false;
+    bIsGrounded = Launch.bIsGrounded;
+    PublishedTrajectory.Reset();
 
     UE_LOG(LogTemp, Log, TEXT("MF_Ball::Kick - Direction: %s, Power: %f, Velocity: %s"),
-           *Direction.ToString(), Power, *Velocity.ToString());
+           *Direction.GetSafeNormal().ToString(), Power, *Velocity.ToString());
 }
 
 void AMF_Ball::SetPossessor(AMF_PlayerCharacter *NewPossessor)
@@ -197,12 +261,14 @@ void AMF_Ball::SetPossessor(AMF_PlayerCharacter *NewPossessor)
         return;
     }
 
+    WakeUp();
+
     AMF_PlayerCharacter *OldPossessor = CurrentPossessor;
 
     if (OldPossessor && !IsValid(OldPossessor))
     {
         OldPossessor = nullptr;
-        CurrentPossessor = nullptr;
+        SetCurrentPossessor(nullptr);
     }
 
     if (NewPossessor && !IsValid(NewPossessor))
@@ -215,8 +281,7 @@ void AMF_Ball::SetPossessor(AMF_PlayerCharacter *NewPossessor)
     {
         OldPossessor->OnDestroyed.RemoveDynamic(this, &AMF_Ball::HandlePossessorDestroyed);
     }
-    CurrentPossessor = NewPossessor;
-    CurrentPossessorWeak = NewPossessor;
+    SetCurrentPossessor(NewPossessor);
 
     // Bind to new possessor destroy event (if any)
     if (IsValid(NewPossessor))
@@ -229,10 +294,11 @@ void AMF_Ball::SetPossessor(AMF_PlayerCharacter *NewPossessor)
         SetBallState(EMF_BallState::Possessed);
         Velocity = FVector::ZeroVector;
         AngularVelocity = FVector::ZeroVector;
+        PublishedTrajectory.Reset();
 
         // Update player state - set BOTH CurrentBall and legacy PossessedBall
         NewPossessor->SetHasBall(true);
-        NewPossessor->CurrentBall = this;  // CRITICAL: Set CurrentBall for shoot/pass to work
+        NewPossessor->SetCurrentBall(this); // CRITICAL: Set CurrentBall for shoot/pass to work
         NewPossessor->SetPossessedBall(this);
 
         UE_LOG(LogTemp, Warning, TEXT("MF_Ball::SetPossessor - %s gained possession, AIProfile: %s, AIRunning: %d"),
@@ -247,7 +313,7 @@ void AMF_Ball::SetPossessor(AMF_PlayerCharacter *NewPossessor)
     if (IsValid(OldPossessor) && OldPossessor != NewPossessor)
     {
         OldPossessor->SetHasBall(false);
-        OldPossessor->CurrentBall = nullptr;
+        OldPossessor->SetCurrentBall(nullptr);
         OldPossessor->SetPossessedBall(nullptr);
     }
 
@@ -270,10 +336,9 @@ void AMF_Ball::ReleasePossession()
         OldPossessor->OnDestroyed.RemoveDynamic(this, &AMF_Ball::HandlePossessorDestroyed);
 
         OldPossessor->SetHasBall(false);
-        OldPossessor->CurrentBall = nullptr;
+        OldPossessor->SetCurrentBall(nullptr);
         OldPossessor->SetPossessedBall(nullptr);
-        CurrentPossessor = nullptr;
-        CurrentPossessorWeak = nullptr;
+        SetCurrentPossessor(nullptr);
 
         // Make sure we are not attached to any mesh (defensive; server normally uses math positioning)
         DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
@@ -286,8 +351,7 @@ void AMF_Ball::ReleasePossession()
     else if (CurrentPossessor != nullptr)
     {
         // Possessor pointer exists but is no longer valid; clear safely.
-        CurrentPossessor = nullptr;
-        CurrentPossessorWeak = nullptr;
+        SetCurrentPossessor(nullptr);
         DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
         SetBallState(EMF_BallState::Loose);
         PossessionCooldown = 0.5f;
@@ -302,6 +366,8 @@ void AMF_Ball::ResetToPosition(FVector NewPosition)
         return;
     }
 
+    WakeUp();
+
     // Release any possession
     ReleasePossession();
 
@@ -310,13 +376,13 @@ void AMF_Ball::ResetToPosition(FVector NewPosition)
     AngularVelocity = FVector::ZeroVector;
     bIsGrounded = true;
 
-    // Move to position
-    SetActorLocation(NewPosition);
+    // Move to position; the simulation restarts from here next tick
+    CommitTransform(NewPosition, 0.0f);
     SetBallState(EMF_BallState::Loose);
+    bHasSimState = false;
 
-    // Update replicated data
-    ReplicatedPhysics.Location = NewPosition;
-    ReplicatedPhysics.Velocity = FVector::ZeroVector;
+    // Publish the new spot on the next tick
+    PublishedTrajectory.Reset();
 
     UE_LOG(LogTemp, Log, TEXT("MF_Ball::ResetToPosition - %s"), *NewPosition.ToString());
 }
@@ -391,12 +457,14 @@ void AMF_Ball::AssignPossession(AMF_PlayerCharacter* NewOwner)
         return;
     }
 
+    WakeUp();
+
     AMF_PlayerCharacter* OldPossessor = CurrentPossessor;
 
     if (OldPossessor && !IsValid(OldPossessor))
     {
         OldPossessor = nullptr;
-        CurrentPossessor = nullptr;
+        SetCurrentPossessor(nullptr);
     }
 
     if (NewOwner && !IsValid(NewOwner))
@@ -408,17 +476,16 @@ void AMF_Ball::AssignPossession(AMF_PlayerCharacter* NewOwner)
     if (IsValid(OldPossessor))
     {
         OldPossessor->SetHasBall(false);
-        OldPossessor->CurrentBall = nullptr;
+        OldPossessor->SetCurrentBall(nullptr);
     }
 
-    CurrentPossessor = NewOwner;
-    CurrentPossessorWeak = NewOwner;
+    SetCurrentPossessor(NewOwner);
 
     if (IsValid(NewOwner))
     {
         // Update new owner's state
         NewOwner->SetHasBall(true);
-        NewOwner->CurrentBall = this;
+        NewOwner->SetCurrentBall(this);
 
         // Attach ball to player mesh at BallSocket
         if (USkeletalMeshComponent* Mesh = NewOwner->GetMesh())
@@ -433,6 +500,7 @@ void AMF_Ball::AssignPossession(AMF_PlayerCharacter* NewOwner)
         SetBallState(EMF_BallState::Possessed);
         Velocity = FVector::ZeroVector;
         AngularVelocity = FVector::ZeroVector;
+        PublishedTrajectory.Reset();
 
         UE_LOG(LogTemp, Log, TEXT("MF_Ball::AssignPossession - Assigned to %s"), *NewOwner->GetName());
     }
@@ -460,10 +528,9 @@ void AMF_Ball::ClearPossession()
         OldPossessor->OnDestroyed.RemoveDynamic(this, &AMF_Ball::HandlePossessorDestroyed);
 
         OldPossessor->SetHasBall(false);
-        OldPossessor->CurrentBall = nullptr;
+        OldPossessor->SetCurrentBall(nullptr);
 
-        CurrentPossessor = nullptr;
-        CurrentPossessorWeak = nullptr;
+        SetCurrentPossessor(nullptr);
         DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
 
         // Small cooldown before can be picked up again
@@ -474,8 +541,7 @@ void AMF_Ball::ClearPossession()
     }
     else if (CurrentPossessor != nullptr)
     {
-        CurrentPossessor = nullptr;
-        CurrentPossessorWeak = nullptr;
+        SetCurrentPossessor(nullptr);
         DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
         SetBallState(EMF_BallState::Loose);
         PossessionCooldown = 0.5f;
@@ -503,6 +569,13 @@ void AMF_Ball::OnBallOverlap(UPrimitiveComponent *OverlappedComponent, AActor *O
         return;
     }
 
+    // A player walked into a sleeping ball's pickup sphere
+    if (bSleeping)
+    {
+        WakeUp();
+        return;
+    }
+
         UE_LOG(LogTemp, Log, TEXT("MF_Ball::OnBallOverlap - PlayerPtr: %p, CanPickup: %d"),
             (void*)Player, CanBePickedUpBy(Player));
 
@@ -522,44 +595,56 @@ void AMF_Ball::CheckForNearbyPlayers()
         return;
     }
 
-    // Find all player characters and check distance
+    UMF_PlayerSnapshotSubsystem *Snapshots = UMF_PlayerSnapshotSubsystem::Get(this);
+    if (!Snapshots)
+    {
+        return;
+    }
+
+    // Only players inside the pickup radius are candidates
+    const FMF_PlayerSnapshot &Snapshot = Snapshots->GetSnapshot();
     FVector BallLocation = GetActorLocation();
+    const float PickupRadius = MF_Constants::BallPickupRadius;
 
     // Debug: count players found
-    int32 PlayerCount = 0;
+    const int32 PlayerCount = Snapshot.Num();
 
-    for (TActorIterator<AMF_PlayerCharacter> It(GetWorld()); It; ++It)
-    {
-        AMF_PlayerCharacter *Player = *It;
-        if (!Player)
-        {
-            continue;
-        }
+    TArray<int32> Candidates;
+    Snapshot.Grid.QueryRadius(BallLocation, PickupRadius, MF_TeamMask::All, Candidates);
 
-        PlayerCount++;
+    // Closest eligible player wins
+    AMF_PlayerCharacter *BestPlayer = nullptr;
+    float BestDist = PickupRadius;
 
-        float Dist = FVector::Dist(BallLocation, Player->GetActorLocation());
-        float PickupRadius = MF_Constants::BallPickupRadius;
+    for (const int32 Index : Candidates)
+    {
+        AMF_PlayerCharacter *Player = Snapshot.Characters[Index];
+        float Dist = FVector::Dist(BallLocation, Snapshot.Positions[Index]);
 
-        // Always log distance for debugging
+        // Log candidate distances for debugging
         static float LastDistLogTime = 0.0f;
         float CurrentTime = GetWorld()->GetTimeSeconds();
         if (CurrentTime - LastDistLogTime > 1.0f) // Log every second
         {
-            UE_LOG(LogTemp, Warning, TEXT("MF_Ball::CheckForNearbyPlayers - Player: %s, Distance: %.1f, PickupRadius: %.1f, InRange: %d, CanPickup: %d"),
-                   *Player->GetName(), Dist, PickupRadius, Dist <= PickupRadius, CanBePickedUpBy(Player));
+            UE_LOG(LogTemp, Warning, TEXT("MF_Ball::CheckForNearbyPlayers - Player: %s, Distance: %.1f, PickupRadius: %.1f, CanPickup: %d"),
+                   *Player->GetName(), Dist, PickupRadius, CanBePickedUpBy(Player));
             LastDistLogTime = CurrentTime;
         }
 
-        if (Dist <= PickupRadius && CanBePickedUpBy(Player))
+        if (Dist <= BestDist && CanBePickedUpBy(Player))
         {
-            UE_LOG(LogTemp, Warning, TEXT("MF_Ball::CheckForNearbyPlayers - PICKING UP! Player: %s, Distance: %.1f"),
-                   *Player->GetName(), Dist);
-            SetPossessor(Player);
-            break; // Only one player can pick up at a time
+            BestPlayer = Player;
+            BestDist = Dist;
         }
     }
 
+    if (BestPlayer)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("MF_Ball::CheckForNearbyPlayers - PICKING UP! Player: %s, Distance: %.1f"),
+               *BestPlayer->GetName(), BestDist);
+        SetPossessor(BestPlayer); // Only one player can pick up at a time
+    }
+
     // Debug: Log if no players found
     static float LastNoPlayerLogTime = 0.0f;
     float CurrentTime = GetWorld()->GetTimeSeconds();
@@ -576,15 +661,23 @@ void AMF_Ball::OnRep_BallState()
 {
     OnBallStateChanged.Broadcast(this, CurrentBallState);
 
-    // Prevent pickup overlap callbacks while possessed or out-of-bounds.
-    if (CollisionSphere)
+    RefreshPickupOverlap();
+
+    UE_LOG(LogTemp, Log, TEXT("MF_Ball::OnRep_BallState - State: %d"), static_cast<int32>(CurrentBallState));
+}
+
+void AMF_Ball::RefreshPickupOverlap()
+{
+    if (!CollisionSphere)
     {
-        const bool bEnablePickupOverlap = (CurrentBallState != EMF_BallState::Possessed) && (CurrentBallState != EMF_BallState::OutOfBounds);
-        CollisionSphere->SetGenerateOverlapEvents(bEnablePickupOverlap);
-        CollisionSphere->SetCollisionEnabled(bEnablePickupOverlap ? ECollisionEnabled::QueryOnly : ECollisionEnabled::NoCollision);
+        return;
     }
 
-    UE_LOG(LogTemp, Log, TEXT("MF_Ball::OnRep_BallState - State: %d"), static_cast<int32>(CurrentBallState));
+    // Prevent pickup overlap callbacks while possessed or out-of-bounds. Otherwise overlaps only
+    // serve as the wake-up trigger of a sleeping ball (or pickup on the legacy path)
+    const bool bEnablePickupOverlap = (CurrentBallState != EMF_BallState::Possessed) && (CurrentBallState != EMF_BallState::OutOfBounds);
+    CollisionSphere->SetGenerateOverlapEvents(bEnablePickupOverlap && (bSleeping || CVarBallLegacyTransform.GetValueOnGameThread() != 0));
+    CollisionSphere->SetCollisionEnabled(bEnablePickupOverlap ? ECollisionEnabled::QueryOnly : ECollisionEnabled::NoCollision);
 }
 
 void AMF_Ball::OnRep_Possessor()
@@ -598,6 +691,9 @@ void AMF_Ball::OnRep_Possessor()
     AMF_PlayerCharacter* Possessor = CurrentPossessorWeak.Get();
     if (IsValid(Possessor))
     {
+        // The character replicates its ball by slot; hand it this ball in case the slot did not resolve
+        Possessor->ResolveCurrentBall(this);
+
         if (USkeletalMeshComponent* Mesh = Possessor->GetMesh())
         {
             AttachToComponent(
@@ -623,8 +719,7 @@ void AMF_Ball::HandlePossessorDestroyed(AActor* DestroyedActor)
     if (DestroyedActor && DestroyedActor == CurrentPossessor)
     {
         // Possessor was destroyed; drop possession safely without touching destroyed actor state.
-        CurrentPossessor = nullptr;
-        CurrentPossessorWeak = nullptr;
+        SetCurrentPossessor(nullptr);
         DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
         SetBallState(EMF_BallState::Loose);
         PossessionCooldown = 0.5f;
@@ -636,193 +731,223 @@ void AMF_Ball::HandlePossessorDestroyed(AActor* DestroyedActor)
 
 void AMF_Ball::OnRep_BallPhysics()
 {
-    // Set interpolation target
-    InterpolationTarget = ReplicatedPhysics.Location;
-    InterpolationVelocity = ReplicatedPhysics.Velocity;
-    LastReplicatedPosition = ReplicatedPhysics.Location;
-}
+    // The timestamp arrives wrapped; restore it against our estimate of server time
+    const AGameStateBase *GameState = GetWorld() ? GetWorld()->GetGameState() : nullptr;
+    const float ServerNow = GameState ? GameState->GetServerWorldTimeSeconds() : ReplicatedPhysics.ServerTimestamp;
+    ReplicatedPhysics.ServerTimestamp = FMF_BallReplicationData::UnwrapTimestamp(ReplicatedPhysics.ServerTimestamp, ServerNow);
 
-// ==================== Internal Physics ====================
+    // Kinematic state for client-side GetVelocity / prediction queries
+    Velocity = ReplicatedPhysics.Velocity;
+    bIsGrounded = ReplicatedPhysics.bIsGrounded;
 
-void AMF_Ball::UpdatePhysics(float DeltaTime)
-{
-    // Apply forces (gravity, friction)
-    ApplyForces(DeltaTime);
 
-    // Update position
-    FVector NewLocation = GetActorLocation() + Velocity * DeltaTime;
-    SetActorLocation(NewLocation);
+    // Dead-reckon from the new state; keep what is on screen and blend the difference out
+    FMF_BallPhysicsState State;
+    State.Location = ReplicatedPhysics.Location;
+    State.Velocity = Velocity;
+    State.bIsGrounded = bIsGrounded;
+    ClientTrajectory.Emplace(State, BallRadius);
 
-    // Update rotation from angular velocity (visual only)
-    if (!AngularVelocity.IsNearlyZero())
+    const FVector Predicted = ClientTrajectory->GetPosition(ServerNow - ReplicatedPhysics.ServerTimestamp);
+
+    ClientCorrectionOffset = GetActorLocation() - Predicted;
+    if (ClientCorrectionOffset.SizeSquared() > FMath::Square(ClientSnapDistance))
     {
-        FRotator DeltaRotation = FRotator(
-            FMath::RadiansToDegrees(AngularVelocity.Y * DeltaTime),
-            FMath::RadiansToDegrees(AngularVelocity.Z * DeltaTime),
-            FMath::RadiansToDegrees(AngularVelocity.X * DeltaTime));
-        AddActorLocalRotation(DeltaRotation);
+        ClientCorrectionOffset = FVector::ZeroVector;
     }
 
-    // Check collisions
-    CheckGroundCollision();
-    CheckBoundaryCollisions();
-    CheckGoalCollisions();
+    ResolvePossessor();
+}
 
-    // Check if ball has stopped
-    if (bIsGrounded && Velocity.SizeSquared() < 100.0f) // Less than 10 cm/s
+void AMF_Ball::ResolvePossessor()
+{
+    if (HasAuthority())
     {
-        Velocity = FVector::ZeroVector;
-        AngularVelocity = FVector::ZeroVector;
+        return;
+    }
 
-        if (CurrentBallState == EMF_BallState::InFlight)
-        {
-            SetBallState(EMF_BallState::Loose);
-        }
+    const uint8 Slot = ReplicatedPhysics.PossessorSlot;
+    UMF_PlayerSnapshotSubsystem *Snapshots = UMF_PlayerSnapshotSubsystem::Get(this);
+    AMF_PlayerCharacter *Resolved = (Slot != MF_Constants::InvalidMatchSlot && Snapshots) ? Snapshots->FindPlayerBySlot(Slot) : nullptr;
+
+    // Slot not resolvable yet: the character calls back once its slot replicates
+    if (Resolved != CurrentPossessor && (Resolved || Slot == MF_Constants::InvalidMatchSlot))
+    {
+        CurrentPossessor = Resolved;
+        OnRep_Possessor();
     }
 }
 
-void AMF_Ball::ApplyForces(float DeltaTime)
+// ==================== Prediction ====================
+
+FVector AMF_Ball::GetVelocity() const
 {
-    // Gravity (only if not grounded)
-    if (!bIsGrounded)
+    if (IsPossessed())
     {
-        Velocity.Z -= MF_Constants::Gravity * DeltaTime;
+        const AMF_PlayerCharacter *Possessor = CurrentPossessorWeak.Get();
+        return IsValid(Possessor) ? Possessor->GetVelocity() : FVector::ZeroVector;
     }
+    return Velocity;
+}
 
-    // Friction (ground friction when grounded, air resistance when flying)
-    float FrictionCoeff = bIsGrounded ? MF_Constants::BallFriction : MF_Constants::BallAirResistance;
+FMF_BallTrajectory AMF_Ball::GetTrajectory() const
+{
+    FMF_BallPhysicsState State;
+    State.Location = bHasSimState ? SimLocation : GetActorLocation();
+    State.bIsGrounded = bIsGrounded;
 
-    // Apply friction to XY velocity
-    FVector XYVelocity = FVector(Velocity.X, Velocity.Y, 0.0f);
-    if (!XYVelocity.IsNearlyZero())
+    // Possessed / out of bounds: the ball goes wherever the actor puts it
+    if (IsLoose() || IsInFlight())
     {
-        float Deceleration = FrictionCoeff * DeltaTime;
-        float CurrentSpeed = XYVelocity.Size();
-        float NewSpeed = FMath::Max(0.0f, CurrentSpeed - Deceleration);
-
-        XYVelocity = XYVelocity.GetSafeNormal() * NewSpeed;
-        Velocity.X = XYVelocity.X;
-        Velocity.Y = XYVelocity.Y;
+        State.Velocity = Velocity;
+        State.AngularVelocity = AngularVelocity;
     }
-
-    // Angular velocity decay
-    AngularVelocity *= (1.0f - 2.0f * DeltaTime);
+    return FMF_BallTrajectory(State, BallRadius);
 }
 
-void AMF_Ball::CheckGroundCollision()
+FVector AMF_Ball::PredictPosition(float Time) const
 {
-    float GroundZ = MF_Constants::GroundZ + BallRadius;
-    FVector Location = GetActorLocation();
-
-    if (Location.Z <= GroundZ)
-    {
-        // Hit ground
-        if (!bIsGrounded && Velocity.Z < 0.0f)
-        {
-            // Bounce
-            float BounceVelocity = -Velocity.Z * MF_Constants::BallBounciness;
+    return GetTrajectory().GetPosition(Time);
+}
 
-            if (BounceVelocity > 50.0f) // Minimum bounce threshold
-            {
-                Velocity.Z = BounceVelocity;
-                bIsGrounded = false;
-            }
-            else
-            {
-                Velocity.Z = 0.0f;
-                bIsGrounded = true;
-            }
-        }
+float AMF_Ball::TimeToReach(FVector Point) const
+{
+    return GetTrajectory().GetTimeToReach(Point);
+}
 
-        // Clamp to ground
-        Location.Z = GroundZ;
-        SetActorLocation(Location);
-    }
-    else
-    {
-        bIsGrounded = false;
-    }
+FVector AMF_Ball::GetLandingPoint() const
+{
+    return GetTrajectory().GetLandingPoint();
 }
 
-void AMF_Ball::CheckBoundaryCollisions()
+FVector AMF_Ball::GetStopPoint() const
 {
-    FVector Location = GetActorLocation();
-    bool bOutOfBounds = false;
+    return GetTrajectory().GetStopPoint();
+}
+
+// ==================== Internal Physics ====================
 
-    // Check X boundaries (side lines)
-    float HalfWidth = MF_Constants::FieldWidth / 2.0f;
-    if (FMath::Abs(Location.X) > HalfWidth + MF_Constants::OutOfBoundsBuffer)
+void AMF_Ball::UpdatePhysics(float DeltaTime)
+{
+    // (Re)start the simulation from wherever the actor is (kick off a player, reset, ...)
+    if (!bHasSimState)
     {
-        bOutOfBounds = true;
+        SimLocation = GetActorLocation();
+        PrevSimLocation = SimLocation;
+        PhysicsStepper.Reset();
+        SimTime = GetWorld()->GetTimeSeconds();
+        bHasSimState = true;
     }
 
-    // Check Y boundaries (goal lines - but not in goal area)
-    float HalfLength = MF_Constants::FieldLength / 2.0f;
-    if (FMath::Abs(Location.Y) > HalfLength + MF_Constants::OutOfBoundsBuffer)
+    // Fixed steps: trajectories, bounces and stopping distance don't depend on server frame rate
+    const float StepDt = 1.0f / FMath::Max(PhysicsStepRate, 1.0f);
+    const int32 Steps = PhysicsStepper.Advance(DeltaTime, StepDt, FMath::Max(MaxPhysicsSubsteps, 1));
+
+    for (int32 Step = 0; Step < Steps; ++Step)
     {
-        // Check if it's in the goal width range
-        float HalfGoalWidth = MF_Constants::GoalWidth / 2.0f;
-        if (FMath::Abs(Location.X) > HalfGoalWidth)
+        StepPhysics(StepDt);
+
+        // Goal / out of bounds / pickup hand the ball back to the actor
+        if (!bHasSimState || (CurrentBallState != EMF_BallState::Loose && CurrentBallState != EMF_BallState::InFlight))
         {
-            bOutOfBounds = true;
+            return;
         }
     }
 
-    // Wall bounces (before going fully out of bounds)
-    if (FMath::Abs(Location.X) > HalfWidth - BallRadius)
-    {
-        // Bounce off side wall
-        Velocity.X = -Velocity.X * MF_Constants::BallBounciness;
-        Location.X = FMath::Sign(Location.X) * (HalfWidth - BallRadius);
-        SetActorLocation(Location);
+    // Render between the last two steps
+    CommitTransform(FMath::Lerp(PrevSimLocation, SimLocation, PhysicsStepper.GetAlpha(StepDt)), DeltaTime);
+}
+
+void AMF_Ball::StepPhysics(float StepDt)
+{
+    PrevSimLocation = SimLocation;
+    const float StepStartTime = SimTime;
+    SimTime += StepDt;
+
+    // Gravity, friction, integration and ground bounce on plain state
+    FMF_BallPhysicsState State;
+    State.Location = SimLocation;
+    State.Velocity = Velocity;
+    State.AngularVelocity = AngularVelocity;
+    State.bIsGrounded = bIsGrounded;
+
+    const bool bAtRest = MF_BallPhysics::Step(State, StepDt, BallRadius);
+
+    SimLocation = State.Location;
+    Velocity = State.Velocity;
+    AngularVelocity = State.AngularVelocity;
+    bIsGrounded = State.bIsGrounded;
+
+    // Swept goal line / touchline test over this step's segment
+    const FMF_FieldLandmarks &Landmarks = UMF_FieldLandmarksSubsystem::GetLandmarks(this);
+    FMF_BallCrossing Crossing;
+    if (Landmarks.SweepBall(PrevSimLocation, SimLocation, BallRadius, Crossing))
+    {
+        Crossing.Time = StepStartTime + Crossing.Fraction * StepDt;
+        HandleBoundaryCrossing(Crossing);
+        if (!bHasSimState)
+        {
+            return;
+        }
     }
 
-    if (bOutOfBounds)
+    // Ball has stopped
+    if (bAtRest && CurrentBallState == EMF_BallState::InFlight)
     {
-        SetBallState(EMF_BallState::OutOfBounds);
-        Velocity = FVector::ZeroVector;
-        AngularVelocity = FVector::ZeroVector;
-        OnBallOutOfBounds.Broadcast(this);
-
-        // TODO: Implement Free throw or Corner Kick rules (currently just resetting to center)
-        ResetToPosition(FVector(0.0f, 0.0f, MF_Constants::GroundZ + BallRadius));
+        SetBallState(EMF_BallState::Loose);
     }
 }
 
-void AMF_Ball::CheckGoalCollisions()
+void AMF_Ball::HandleBoundaryCrossing(const FMF_BallCrossing &Crossing)
 {
-    if (CurrentBallState == EMF_BallState::OutOfBounds)
+    const FMF_FieldLandmarks &Landmarks = UMF_FieldLandmarksSubsystem::GetLandmarks(this);
+    const FVector KickoffSpot = Landmarks.CenterSpot + FVector(0.0f, 0.0f, MF_Constants::GroundZ + BallRadius);
+
+    OnBoundaryCrossed.Broadcast(this, Crossing);
+
+    switch (Crossing.Type)
     {
-        return;
+    case EMF_BallCrossing::Touchline:
+    {
+        // Rebound off the side boards at the crossing point; mirror the rest of the step back in
+        SimLocation.X = 2.0f * Crossing.Point.X - SimLocation.X;
+        Velocity.X = -Velocity.X * MF_Constants::BallBounciness;
+        PublishedTrajectory.Reset();
+        break;
     }
+    case EMF_BallCrossing::Goal:
+    {
+        // The team that does NOT defend this goal line scores
+        const EMF_TeamID ScoringTeam = FMF_FieldLandmarks::Opponent(Crossing.LineTeam);
+        UE_LOG(LogTemp, Log, TEXT("GOAL! Team %d scores at %s (t=%.3f)"), static_cast<int32>(ScoringTeam), *Crossing.Point.ToString(), Crossing.Time);
 
-    FVector Location = GetActorLocation();
-    float HalfLength = MF_Constants::FieldLength / 2.0f;
-    float HalfGoalWidth = MF_Constants::GoalWidth / 2.0f;
+        OnGoalScored.Broadcast(this, ScoringTeam);
+        if (AMF_Goal *Goal = Landmarks.Goals[static_cast<uint8>(Crossing.LineTeam)].Get())
+        {
+            Goal->NotifyBallEntered(this);
+        }
 
-    // Check Team A goal (positive Y end)
-    if (Location.Y > HalfLength && FMath::Abs(Location.X) < HalfGoalWidth && Location.Z < MF_Constants::GoalHeight)
-    {
-        // Team B scored!
-        OnGoalScored.Broadcast(this, EMF_TeamID::TeamB);
         SetBallState(EMF_BallState::OutOfBounds);
         Velocity = FVector::ZeroVector;
-        UE_LOG(LogTemp, Log, TEXT("GOAL! Team B scores!"));
+        AngularVelocity = FVector::ZeroVector;
 
         // Reset to center for kickoff
-        ResetToPosition(FVector(0.0f, 0.0f, MF_Constants::GroundZ + BallRadius));
+        ResetToPosition(KickoffSpot);
+        break;
     }
-    // Check Team B goal (negative Y end)
-    else if (Location.Y < -HalfLength && FMath::Abs(Location.X) < HalfGoalWidth && Location.Z < MF_Constants::GoalHeight)
+    case EMF_BallCrossing::GoalLine:
     {
-        // Team A scored!
-        OnGoalScored.Broadcast(this, EMF_TeamID::TeamA);
         SetBallState(EMF_BallState::OutOfBounds);
         Velocity = FVector::ZeroVector;
-        UE_LOG(LogTemp, Log, TEXT("GOAL! Team A scores!"));
+        AngularVelocity = FVector::ZeroVector;
+        OnBallOutOfBounds.Broadcast(this);
 
-        // Reset to center for kickoff
-        ResetToPosition(FVector(0.0f, 0.0f, MF_Constants::GroundZ + BallRadius));
+        // TODO: Implement goal kick or corner kick rules (currently just resetting to center)
+        ResetToPosition(KickoffSpot);
+        break;
+    }
+    default:
+        break;
     }
 }
 
@@ -840,8 +965,7 @@ void AMF_Ball::UpdatePossessedPosition()
         if (HasAuthority())
         {
             SetBallState(EMF_BallState::Loose);
-            CurrentPossessor = nullptr;
-            CurrentPossessorWeak = nullptr;
+            SetCurrentPossessor(nullptr);
         }
         return;
     }
@@ -853,7 +977,7 @@ void AMF_Ball::UpdatePossessedPosition()
     FVector Offset = PlayerRotation.RotateVector(PossessionOffset);
     FVector NewLocation = PlayerLocation + Offset;
 
-    SetActorLocation(NewLocation);
+    CommitTransform(NewLocation, 0.0f);
 
     // Debug: Log ball following player
     static float LastLogTime = 0.0f;
@@ -878,12 +1002,184 @@ void AMF_Ball::ClientInterpolate(float DeltaTime)
         return;
     }
 
-    // Interpolate towards replicated position
-    FVector CurrentLocation = GetActorLocation();
-    float InterpSpeed = 15.0f; // Adjust for smoothness vs responsiveness
+    if (!ClientTrajectory.IsSet())
+    {
+        return;
+    }
+
+    // Where the server's ball is now, by the same model it simulates with
+    const AGameStateBase *GameState = GetWorld()->GetGameState();
+    const float ServerNow = GameState ? GameState->GetServerWorldTimeSeconds() : GetWorld()->GetTimeSeconds();
+    const FVector Predicted = ClientTrajectory->GetPosition(ServerNow - ReplicatedPhysics.ServerTimestamp);
+
+    // Exponential blend of the last correction (frame-rate independent)
+    ClientCorrectionOffset *= FMath::Exp(-ClientCorrectionSpeed * DeltaTime);
+    if (ClientCorrectionOffset.SizeSquared() < 0.01f)
+    {
+        ClientCorrectionOffset = FVector::ZeroVector;
+    }
+
+    // A ball at rest costs nothing to render
+    const FVector NewLocation = Predicted + ClientCorrectionOffset;
+    const FVector Moved = NewLocation - GetActorLocation();
+    if (Moved.IsNearlyZero(0.01f))
+    {
+        return;
+    }
+
+    // Spin is not replicated; roll the client ball the way Kick spins it (Power / 100 per unit direction)
+    if (DeltaTime > 0.0f)
+    {
+        AngularVelocity = FVector::CrossProduct(FVector::UpVector, FVector(Moved.X, Moved.Y, 0.0f) / DeltaTime) / 100.0f;
+    }
+    CommitTransform(NewLocation, DeltaTime);
+}
+
+void AMF_Ball::PublishPhysicsState()
+{
+    // Clients carry the ball with the possessor; one publish on pickup stops the extrapolation
+    if (CurrentBallState == EMF_BallState::Possessed && PublishedTrajectory.IsSet())
+    {
+        return;
+    }
+
+    // Latest simulated step, not the blended render position
+    const FVector Location = bHasSimState ? SimLocation : GetActorLocation();
+    const float Timestamp = bHasSimState ? SimTime : GetWorld()->GetTimeSeconds();
+
+    // Clients extrapolate the last published state; only correct them once they drift
+    if (PublishedTrajectory.IsSet() &&
+        FVector::DistSquared(PublishedTrajectory->GetPosition(Timestamp - ReplicatedPhysics.ServerTimestamp), Location) <=
+            FMath::Square(ReplicationErrorTolerance))
+    {
+        return;
+    }
+
+    const AMF_PlayerCharacter *Possessor = CurrentPossessorWeak.Get();
+    ReplicatedPhysics.Location = Location;
+    ReplicatedPhysics.Velocity = Velocity;
+    ReplicatedPhysics.ServerTimestamp = Timestamp;
+    ReplicatedPhysics.State = CurrentBallState;
+    ReplicatedPhysics.bIsGrounded = bIsGrounded;
+    ReplicatedPhysics.PossessorSlot = IsValid(Possessor) ? Possessor->GetMatchSlot() : MF_Constants::InvalidMatchSlot;
+    MARK_PROPERTY_DIRTY_FROM_NAME(AMF_Ball, ReplicatedPhysics, this);
+
+    // A correction (kick, bounce, pickup) is sent straight away rather than at the current tier's rate
+    ForceNetUpdate();
+
+    FMF_BallPhysicsState State;
+    State.Location = Location;
+    State.Velocity = Velocity;
+    State.bIsGrounded = bIsGrounded;
+    PublishedTrajectory.Emplace(State, BallRadius);
+}
+
+void AMF_Ball::CommitTransform(const FVector &NewLocation, float DeltaTime)
+{
+    SCOPE_CYCLE_COUNTER(STAT_MF_BallTransformCommit);
+    INC_DWORD_STAT(STAT_MF_BallTransformCommits);
+
+    const bool bHasSpin = DeltaTime > 0.0f && !AngularVelocity.IsNearlyZero();
+
+    if (CVarBallLegacyTransform.GetValueOnGameThread() != 0)
+    {
+        SetActorLocation(NewLocation);
+        if (bHasSpin)
+        {
+            AddActorLocalRotation(MF_SpinDelta(AngularVelocity, DeltaTime));
+        }
+        return;
+    }
+
+    if (bHasSpin && GetNetMode() != NM_DedicatedServer)
+    {
+        SetActorLocationAndRotation(NewLocation, GetActorQuat() * MF_SpinDelta(AngularVelocity, DeltaTime),
+                                    false, nullptr, ETeleportType::TeleportPhysics);
+    }
+    else
+    {
+        SetActorLocation(NewLocation, false, nullptr, ETeleportType::TeleportPhysics);
+    }
+}
+
+// ==================== Sleep ====================
+
+void AMF_Ball::UpdateSleep(float DeltaTime)
+{
+    // Only a loose ball at rest can sleep; anything else restarts the countdown
+    if (!bHasSimState || CurrentBallState != EMF_BallState::Loose || !Velocity.IsZero() || !bIsGrounded ||
+        CVarBallSleep.GetValueOnGameThread() == 0)
+    {
+        RestTime = 0.0f;
+        return;
+    }
+
+    RestTime += DeltaTime;
+    if (RestTime < SleepDelay)
+    {
+        return;
+    }
+
+    // Nobody inside the pickup sphere (they would never trigger the wake-up overlap)
+    if (UMF_PlayerSnapshotSubsystem *Snapshots = UMF_PlayerSnapshotSubsystem::Get(this))
+    {
+        TArray<int32> Nearby;
+        Snapshots->GetSnapshot().Grid.QueryRadius(SimLocation, MF_Constants::BallPickupRadius, MF_TeamMask::All, Nearby);
+        if (Nearby.Num() > 0)
+        {
+            return;
+        }
+    }
+
+    GoToSleep();
+}
+
+void AMF_Ball::GoToSleep()
+{
+    if (bSleeping || !HasAuthority())
+    {
+        return;
+    }
+
+    // Final resting state goes out before the channel closes
+    PublishedTrajectory.Reset();
+    PublishPhysicsState();
+
+    bSleeping = true;
+    RestTime = 0.0f;
+    SetActorTickEnabled(false);
+    SetNetDormancy(DORM_DormantAll);
+    RefreshPickupOverlap();
 
-    FVector NewLocation = FMath::VInterpTo(CurrentLocation, InterpolationTarget, DeltaTime, InterpSpeed);
-    SetActorLocation(NewLocation);
+    UE_LOG(LogTemp, Log, TEXT("MF_Ball::GoToSleep - Resting at %s"), *GetActorLocation().ToString());
+}
+
+void AMF_Ball::WakeUp()
+{
+    if (!bSleeping)
+    {
+        return;
+    }
+
+    bSleeping = false;
+    RestTime = 0.0f;
+    SetActorTickEnabled(true);
+    SetNetDormancy(DORM_Awake);
+    RefreshPickupOverlap();
+
+    // Simulation restarts from the resting spot; the missed frames were all at rest
+    bHasSimState = false;
+
+    UE_LOG(LogTemp, Log, TEXT("MF_Ball::WakeUp"));
+}
+
+void AMF_Ball::UpdateNetActivity()
+{
+    const UMF_NetworkSettings *Settings = UMF_NetworkSettings::Get();
+    if (Settings->bAdaptiveNetUpdateFrequency)
+    {
+        Settings->ApplyNetActivity(*this, NetActivity, Settings->ClassifyBall(CurrentBallState, Velocity.Size2D()));
+    }
 }
 
 void AMF_Ball::SetBallState(EMF_BallState NewState)
@@ -891,6 +1187,7 @@ void AMF_Ball::SetBallState(EMF_BallState NewState)
     if (CurrentBallState != NewState)
     {
         CurrentBallState = NewState;
+        MARK_PROPERTY_DIRTY_FROM_NAME(AMF_Ball, CurrentBallState, this);
 
         // Call rep notify on server too for local effects
         if (HasAuthority())
@@ -899,3 +1196,12 @@ void AMF_Ball::SetBallState(EMF_BallState NewState)
         }
     }
 }
+
+void AMF_Ball::SetCurrentPossessor(AMF_PlayerCharacter *NewPossessor)
+{
+    CurrentPossessor = NewPossessor;
+    CurrentPossessorWeak = NewPossessor;
+
+    // Clients learn the possessor from ReplicatedPhysics.PossessorSlot
+    PublishedTrajectory.Reset();
+}
@@ -1,8 +1,9 @@
 /*
  * @Author: Punal Manalan
  * @Description: MF_Ball - Replicated Ball Actor Header
- *               Math-based ball physics (NO UE Physics)
- *               Full network replication for Listen Server and Dedicated Server
+ *               Math-based ball physics (NO UE Physics), fixed-step with render interpolation
+ *               Full network replication for Listen Server and Dedicated Server,
+ *               clients dead-reckon with the same model between updates
  * @Date: 07/12/2025
  */
 
@@ -11,6 +12,7 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "Core/MF_Types.h"
+#include "Ball/MF_BallPhysics.h"
 #include "MF_Ball.generated.h"
 
 class AMF_PlayerCharacter;
@@ -21,15 +23,20 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnBallPossessionChanged, AMF_Bal
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnBallStateChanged, AMF_Ball *, Ball, EMF_BallState, NewState);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnBallOutOfBounds, AMF_Ball *, Ball);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnGoalScored, AMF_Ball *, Ball, EMF_TeamID, ScoringTeam);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnBallBoundaryCrossed, AMF_Ball *, Ball, const FMF_BallCrossing &, Crossing);
 
 /**
  * MF_Ball - The football actor
  *
  * Features:
  * - Custom math-based physics (NO UE Physics simulation)
- * - Server authoritative with client interpolation
+ * - Fixed-rate physics steps (PhysicsStepRate) independent of server frame rate
+ * - Goals / out of play from one swept boundary test per step (OnBoundaryCrossed)
+ * - Server authoritative; clients extrapolate the replicated state along the shared
+ *   trajectory model and the server only republishes when that extrapolation drifts
  * - Possession system: ball attaches to possessing player
  * - Kick mechanics for shooting and passing
+ * - Sleeps (no tick, net dormant) at rest with nobody near; wakes on proximity, kick or reset
  */
 UCLASS()
 class P_MINIFOOTBALL_API AMF_Ball : public AActor
@@ -42,6 +49,10 @@ public:
     // ==================== Replication ====================
     virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty> &OutLifetimeProps) const override;
 
+    /** Always relevant (every viewer follows the ball), and ahead of characters when a connection is saturated (UMF_NetworkSettings::BallPriorityScale, activity tier) */
+    virtual float GetNetPriority(const FVector &ViewPos, const FVector &ViewDir, AActor *Viewer, AActor *ViewTarget,
+                                 UActorChannel *InChannel, float Time, bool bLowBandwidth) override;
+
     // ==================== Components ====================
     /** Root collision sphere */
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
@@ -56,8 +67,11 @@ public:
     UPROPERTY(ReplicatedUsing = OnRep_BallState, BlueprintReadOnly, Category = "Ball")
     EMF_BallState CurrentBallState;
 
-    /** Which player has the ball (null if loose/flying) */
-    UPROPERTY(ReplicatedUsing = OnRep_Possessor, BlueprintReadOnly, Category = "Ball")
+    /**
+     * Which player has the ball (null if loose/flying).
+     * Replicated by match slot (ReplicatedPhysics.PossessorSlot); clients resolve it in ResolvePossessor.
+     */
+    UPROPERTY(BlueprintReadOnly, Category = "Ball")
     AMF_PlayerCharacter *CurrentPossessor;
 
     /**
@@ -88,6 +102,46 @@ public:
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Physics")
     float BallRadius;
 
+    /** Fixed simulation rate for loose/in-flight physics (steps per second) */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Physics", meta = (ClampMin = "15", ClampMax = "480"))
+    float PhysicsStepRate = 120.0f;
+
+    /** Max fixed steps per frame; time beyond this is dropped after a hitch */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Physics", meta = (ClampMin = "1", ClampMax = "32"))
+    int32 MaxPhysicsSubsteps = 8;
+
+    // ==================== Network ====================
+    /** Server republishes the ball state once clients' extrapolation of the last one is off by more than this (cm) */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Network", meta = (ClampMin = "0.5"))
+    float ReplicationErrorTolerance = 10.0f;
+
+    /** Client: rate at which the visual error of a correction is blended out (1/s) */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Network", meta = (ClampMin = "1"))
+    float ClientCorrectionSpeed = 10.0f;
+
+    /** Client: corrections larger than this snap instead of blending (cm) */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Network", meta = (ClampMin = "0"))
+    float ClientSnapDistance = 300.0f;
+
+    // ==================== Sleep ====================
+    /** Seconds a loose ball must rest, with no player inside the pickup sphere, before it sleeps */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Sleep", meta = (ClampMin = "0"))
+    float SleepDelay = 1.0f;
+
+    /**
+     * Wake a sleeping ball: ticking and replication resume (Server only).
+     * Kick, reset, possession changes and a player entering the pickup sphere call this.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Ball")
+    void WakeUp();
+
+    /** True while the ball is at rest with ticking and replication off */
+    UFUNCTION(BlueprintPure, Category = "Ball")
+    bool IsSleeping() const { return bSleeping; }
+
+    /** Client: resolve CurrentPossessor from the replicated possessor slot (retried when a character's slot arrives) */
+    void ResolvePossessor();
+
     /** Velocity threshold (squared) for auto-pickup eligibility */
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Possession")
     float AutoPickupVelocityThreshold = 40000.0f;  // cm^2/s^2
@@ -151,6 +205,32 @@ public:
     UFUNCTION(BlueprintPure, Category = "Ball")
     AMF_PlayerCharacter *GetPossessor() const { return CurrentPossessorWeak.Get(); }
 
+    /** Ball velocity (the possessor's while possessed); the base AActor version has no movement component to read */
+    virtual FVector GetVelocity() const override;
+
+    // ==================== Prediction ====================
+    /**
+     * Closed-form trajectory from the current state, using the same model as the physics step.
+     * Ignores walls, goals and players. Build once when making several queries.
+     */
+    FMF_BallTrajectory GetTrajectory() const;
+
+    /** Predicted position Time seconds from now */
+    UFUNCTION(BlueprintPure, Category = "Ball|Prediction")
+    FVector PredictPosition(float Time) const;
+
+    /** Seconds until the ball passes Point (projected onto its path); -1 if it never does */
+    UFUNCTION(BlueprintPure, Category = "Ball|Prediction")
+    float TimeToReach(FVector Point) const;
+
+    /** Where the ball next touches the ground (current location if grounded) */
+    UFUNCTION(BlueprintPure, Category = "Ball|Prediction")
+    FVector GetLandingPoint() const;
+
+    /** Where the ball comes to rest */
+    UFUNCTION(BlueprintPure, Category = "Ball|Prediction")
+    FVector GetStopPoint() const;
+
     // ==================== Events ====================
     UPROPERTY(BlueprintAssignable, Category = "Events")
     FOnBallPossessionChanged OnPossessionChanged;
@@ -164,8 +244,13 @@ public:
     UPROPERTY(BlueprintAssignable, Category = "Events")
     FOnGoalScored OnGoalScored;
 
+    /** Every boundary crossing (goal, goal line, touchline) with its exact time and point; fires before the matching goal/out event */
+    UPROPERTY(BlueprintAssignable, Category = "Events")
+    FOnBallBoundaryCrossed OnBoundaryCrossed;
+
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     virtual void Tick(float DeltaTime) override;
 
     UFUNCTION()
@@ -182,49 +267,90 @@ protected:
     void OnRep_BallPhysics();
 
     // ==================== Internal Physics ====================
-    /** Update ball physics simulation (Server only) */
+    /** Update ball physics simulation (Server only): fixed steps, then interpolated render transform */
     void UpdatePhysics(float DeltaTime);
 
-    /** Apply gravity and friction */
-    void ApplyForces(float DeltaTime);
-
-    /** Check and handle ground collision */
-    void CheckGroundCollision();
-
-    /** Check and handle wall/boundary collisions */
-    void CheckBoundaryCollisions();
+    /** Advance the simulation by one fixed step */
+    void StepPhysics(float StepDt);
 
-    /** Check for goal scoring */
-    void CheckGoalCollisions();
+    /** Goal, out over the goal line, or rebound off the touchline boards (server only) */
+    void HandleBoundaryCrossing(const FMF_BallCrossing &Crossing);
 
     /** Update ball position when possessed */
     void UpdatePossessedPosition();
 
-    /** Interpolate client-side position */
+    /** Client: extrapolate the replicated state along its trajectory, blending out correction error */
     void ClientInterpolate(float DeltaTime);
 
+    /** Server: write ReplicatedPhysics if clients' extrapolation of the last published state has drifted */
+    void PublishPhysicsState();
+
+    /**
+     * The only place the ball actor is moved while not attached: one teleport move per frame,
+     * no sweep, no overlap or physics volume updates. Spin is visual, so it is folded into
+     * the same move everywhere except a dedicated server.
+     */
+    void CommitTransform(const FVector &NewLocation, float DeltaTime);
+
     /** Set ball state with replication */
     void SetBallState(EMF_BallState NewState);
 
+    /** Write CurrentPossessor and its weak handle together, and republish so the possessor slot goes out */
+    void SetCurrentPossessor(AMF_PlayerCharacter *NewPossessor);
+
+    /** Pickup sphere overlaps: off while possessed/out of bounds, on only to wake a sleeping ball (or on the legacy path) */
+    void RefreshPickupOverlap();
+
+    /** Server: count rest time and put the ball to sleep once nobody is near */
+    void UpdateSleep(float DeltaTime);
+
+    /** Server: stop ticking and go net dormant; the pickup sphere overlap becomes the wake-up trigger */
+    void GoToSleep();
+
+    /** Server: re-classify activity and switch NetUpdateFrequency/priority tier on change */
+    void UpdateNetActivity();
+
     /** Handle overlap with player for automatic pickup */
     UFUNCTION()
     void OnBallOverlap(UPrimitiveComponent *OverlappedComponent, AActor *OtherActor,
                        UPrimitiveComponent *OtherComp, int32 OtherBodyIndex,
                        bool bFromSweep, const FHitResult &SweepResult);
 
-    /** Check for nearby players who can pick up the ball (backup for overlap events) */
+    /** Pickup: closest eligible player inside the pickup radius, from the player snapshot */
     void CheckForNearbyPlayers();
 
 private:
     /** Offset from player when possessed */
     FVector PossessionOffset;
 
-    /** Client-side interpolation target */
-    FVector InterpolationTarget;
-    FVector InterpolationVelocity;
+    /** Server: trajectory of the last published ReplicatedPhysics, i.e. what clients are extrapolating (unset = publish next tick) */
+    TOptional<FMF_BallTrajectory> PublishedTrajectory;
+
+    /** Client: trajectory of the latest ReplicatedPhysics, and the visual error still being blended out */
+    TOptional<FMF_BallTrajectory> ClientTrajectory;
+    FVector ClientCorrectionOffset = FVector::ZeroVector;
+
+    /** Fixed-step simulation position after the latest / previous step (the rendered transform blends between them) */
+    FVector SimLocation;
+    FVector PrevSimLocation;
+
+    /** Frame time not yet consumed by whole physics steps */
+    FMF_FixedStepper PhysicsStepper;
+
+    /** World time at the end of the latest simulated step */
+    float SimTime = 0.0f;
+
+    /** False while the actor (not the simulation) owns the ball's position: possessed, reset, out of bounds */
+    bool bHasSimState = false;
+
+    /** Sleeping: tick disabled, net dormant, waiting for WakeUp */
+    bool bSleeping = false;
+
+    /** Seconds the ball has been loose and at rest */
+    float RestTime = 0.0f;
 
-    /** Last replicated position for interpolation */
-    FVector LastReplicatedPosition;
+    /** Update-rate tier last applied (Server only, see UMF_NetworkSettings) */
+    EMF_NetActivity NetActivity = EMF_NetActivity::None;
 
     /** Cooldown for possession changes */
     float PossessionCooldown;
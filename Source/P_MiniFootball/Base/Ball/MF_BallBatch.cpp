@@ -0,0 +1,191 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: MF_BallBatch - Implementation
+ * @Date: 16/10/2026
+ */
+
+#include "Ball/MF_BallBatch.h"
+#include "Match/MF_FieldLandmarks.h"
+
+int32 FMF_BallBatch::Add(const FVector &Location)
+{
+    const int32 Index = PosX.AddUninitialized();
+    PosY.AddUninitialized();
+    PosZ.AddUninitialized();
+    VelX.AddUninitialized();
+    VelY.AddUninitialized();
+    VelZ.AddUninitialized();
+    PrevX.AddUninitialized();
+    PrevY.AddUninitialized();
+    PrevZ.AddUninitialized();
+    Grounded.AddUninitialized();
+    Sleeping.AddUninitialized();
+
+    SetLocation(Index, Location);
+    return Index;
+}
+
+void FMF_BallBatch::RemoveAtSwap(int32 Index)
+{
+    for (TArray<float> *Array : {&PosX, &PosY, &PosZ, &VelX, &VelY, &VelZ, &PrevX, &PrevY, &PrevZ})
+    {
+        Array->RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    }
+    Grounded.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    Sleeping.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+}
+
+void FMF_BallBatch::Reset()
+{
+    for (TArray<float> *Array : {&PosX, &PosY, &PosZ, &VelX, &VelY, &VelZ, &PrevX, &PrevY, &PrevZ})
+    {
+        Array->Reset();
+    }
+    Grounded.Reset();
+    Sleeping.Reset();
+}
+
+void FMF_BallBatch::SetLocation(int32 Index, const FVector &Location)
+{
+    PosX[Index] = PrevX[Index] = static_cast<float>(Location.X);
+    PosY[Index] = PrevY[Index] = static_cast<float>(Location.Y);
+    PosZ[Index] = PrevZ[Index] = static_cast<float>(Location.Z);
+    VelX[Index] = VelY[Index] = VelZ[Index] = 0.0f;
+    Grounded[Index] = 1;
+    Sleeping[Index] = 1;
+}
+
+void FMF_BallBatch::SetVelocity(int32 Index, const FVector &Velocity)
+{
+    VelX[Index] = static_cast<float>(Velocity.X);
+    VelY[Index] = static_cast<float>(Velocity.Y);
+    VelZ[Index] = static_cast<float>(Velocity.Z);
+    Grounded[Index] = Velocity.Z > 0.0f ? 0 : Grounded[Index];
+    Sleeping[Index] = 0;
+}
+
+FMF_BallPhysicsState FMF_BallBatch::GetState(int32 Index) const
+{
+    FMF_BallPhysicsState State;
+    State.Location = GetLocation(Index);
+    State.Velocity = GetVelocity(Index);
+    State.bIsGrounded = Grounded[Index] != 0;
+    return State;
+}
+
+int32 FMF_BallBatch::Step(float StepDt, float Radius)
+{
+    const int32 Count = Num();
+    const float GravityDelta = MF_Constants::Gravity * StepDt;
+    const float GroundDecel = MF_Constants::BallFriction * StepDt;
+    const float AirDecel = MF_Constants::BallAirResistance * StepDt;
+    const float RestZ = MF_Constants::GroundZ + Radius;
+    const float RestSpeedSq = FMath::Square(MF_BallPhysics::RestSpeed);
+
+    float *RESTRICT PX = PosX.GetData();
+    float *RESTRICT PY = PosY.GetData();
+    float *RESTRICT PZ = PosZ.GetData();
+    float *RESTRICT VX = VelX.GetData();
+    float *RESTRICT VY = VelY.GetData();
+    float *RESTRICT VZ = VelZ.GetData();
+    float *RESTRICT QX = PrevX.GetData();
+    float *RESTRICT QY = PrevY.GetData();
+    float *RESTRICT QZ = PrevZ.GetData();
+    uint8 *RESTRICT OnGround = Grounded.GetData();
+    uint8 *RESTRICT Asleep = Sleeping.GetData();
+
+    int32 Simulated = 0;
+    for (int32 Index = 0; Index < Count; ++Index)
+    {
+        QX[Index] = PX[Index];
+        QY[Index] = PY[Index];
+        QZ[Index] = PZ[Index];
+        if (Asleep[Index])
+        {
+            continue;
+        }
+        ++Simulated;
+
+        // Forces: gravity while airborne, linear XY deceleration (MF_BallPhysics::ApplyForces)
+        bool bGrounded = OnGround[Index] != 0;
+        float Vx = VX[Index];
+        float Vy = VY[Index];
+        float Vz = bGrounded ? VZ[Index] : VZ[Index] - GravityDelta;
+
+        if (FMath::Abs(Vx) > UE_KINDA_SMALL_NUMBER || FMath::Abs(Vy) > UE_KINDA_SMALL_NUMBER)
+        {
+            const float Speed = FMath::Sqrt(Vx * Vx + Vy * Vy);
+            const float Scale = FMath::Max(0.0f, Speed - (bGrounded ? GroundDecel : AirDecel)) / Speed;
+            Vx *= Scale;
+            Vy *= Scale;
+        }
+
+        // Integrate
+        const float Px = PX[Index] + Vx * StepDt;
+        const float Py = PY[Index] + Vy * StepDt;
+        float Pz = PZ[Index] + Vz * StepDt;
+
+        // Ground contact (MF_BallPhysics::ResolveGround)
+        if (Pz > RestZ)
+        {
+            bGrounded = false;
+        }
+        else
+        {
+            if (!bGrounded && Vz < 0.0f)
+            {
+                const float Bounce = -Vz * MF_Constants::BallBounciness;
+                bGrounded = Bounce <= MF_BallPhysics::MinBounceSpeed;
+                Vz = bGrounded ? 0.0f : Bounce;
+            }
+            Pz = RestZ;
+        }
+
+        // Rest (MF_BallPhysics::SettleIfAtRest)
+        if (bGrounded && Vx * Vx + Vy * Vy + Vz * Vz < RestSpeedSq)
+        {
+            Vx = Vy = Vz = 0.0f;
+            Asleep[Index] = 1;
+        }
+
+        PX[Index] = Px;
+        PY[Index] = Py;
+        PZ[Index] = Pz;
+        VX[Index] = Vx;
+        VY[Index] = Vy;
+        VZ[Index] = Vz;
+        OnGround[Index] = bGrounded ? 1 : 0;
+    }
+    return Simulated;
+}
+
+void FMF_BallBatch::SweepBoundaries(const FMF_FieldLandmarks &Landmarks, float Radius, TArray<FMF_BallBatchCrossing> &OutCrossings) const
+{
+    OutCrossings.Reset();
+
+    // Broad phase: a ball that ends the step inside every crossing plane has not crossed one outward
+    // (touchlines are hit at the boards, Radius inside the line; goal lines once wholly over)
+    const float CenterX = static_cast<float>(Landmarks.CenterSpot.X);
+    const float CenterY = static_cast<float>(Landmarks.CenterSpot.Y);
+    const float InsideX = static_cast<float>(Landmarks.HalfExtent.X) - Radius;
+    const float InsideY = static_cast<float>(Landmarks.HalfExtent.Y) + Radius;
+
+    const int32 Count = Num();
+    for (int32 Index = 0; Index < Count; ++Index)
+    {
+        if (FMath::Abs(PosX[Index] - CenterX) < InsideX && FMath::Abs(PosY[Index] - CenterY) < InsideY)
+        {
+            continue;
+        }
+
+        FMF_BallBatchCrossing &Result = OutCrossings.AddDefaulted_GetRef();
+        if (Landmarks.SweepBall(GetPrevLocation(Index), GetLocation(Index), Radius, Result.Crossing))
+        {
+            Result.Index = Index;
+        }
+        else
+        {
+            OutCrossings.Pop(EAllowShrinking::No);
+        }
+    }
+}
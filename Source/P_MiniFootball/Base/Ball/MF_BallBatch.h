@@ -0,0 +1,70 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: MF_BallBatch - Structure-of-arrays ball simulation for many balls at once
+ *               Same model as MF_BallPhysics, stepped over every ball in flat loops
+ * @Date: 16/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/MF_Types.h"
+#include "Ball/MF_BallPhysics.h"
+
+struct FMF_FieldLandmarks;
+
+/** One ball of the batch crossed a boundary this step */
+struct FMF_BallBatchCrossing
+{
+    int32 Index = INDEX_NONE;
+    FMF_BallCrossing Crossing;
+};
+
+/**
+ * FMF_BallBatch
+ * Drill balls as plain arrays (index i is the same ball in every array). Step runs gravity,
+ * linear friction, integration, ground bounce and the rest check for every awake ball in one
+ * loop; SweepBoundaries is a bounds-only broad phase that hands just the balls near a line to
+ * FMF_FieldLandmarks::SweepBall. Balls at rest sleep and cost one branch per step until moved.
+ * No actors, no components, no spin.
+ */
+struct P_MINIFOOTBALL_API FMF_BallBatch
+{
+    TArray<float> PosX, PosY, PosZ;
+    TArray<float> VelX, VelY, VelZ;
+
+    /** Position at the start of the latest step (render interpolation, boundary sweep) */
+    TArray<float> PrevX, PrevY, PrevZ;
+
+    TArray<uint8> Grounded;
+    TArray<uint8> Sleeping;
+
+    int32 Num() const { return PosX.Num(); }
+
+    /** Add a ball at rest; returns its index */
+    int32 Add(const FVector &Location);
+
+    /** Remove a ball; the last ball moves into Index */
+    void RemoveAtSwap(int32 Index);
+
+    void Reset();
+
+    /** Place a ball at rest (no interpolation from its old spot) */
+    void SetLocation(int32 Index, const FVector &Location);
+
+    /** Kick: set velocity and wake the ball */
+    void SetVelocity(int32 Index, const FVector &Velocity);
+
+    FVector GetLocation(int32 Index) const { return FVector(PosX[Index], PosY[Index], PosZ[Index]); }
+    FVector GetPrevLocation(int32 Index) const { return FVector(PrevX[Index], PrevY[Index], PrevZ[Index]); }
+    FVector GetVelocity(int32 Index) const { return FVector(VelX[Index], VelY[Index], VelZ[Index]); }
+
+    /** Ball as a scalar physics state (for trajectories / replication) */
+    FMF_BallPhysicsState GetState(int32 Index) const;
+
+    /** One fixed step for every awake ball; returns how many were simulated */
+    int32 Step(float StepDt, float Radius);
+
+    /** Earliest boundary crossing of each ball over its latest step (Prev -> Pos); Time is left to the caller */
+    void SweepBoundaries(const FMF_FieldLandmarks &Landmarks, float Radius, TArray<FMF_BallBatchCrossing> &OutCrossings) const;
+};
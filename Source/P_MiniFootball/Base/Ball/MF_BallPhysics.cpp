@@ -0,0 +1,236 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: MF_BallPhysics - Implementation
+ * @Date: 16/10/2026
+ */
+
+#include "Ball/MF_BallPhysics.h"
+
+namespace MF_BallPhysics
+{
+    void ApplyForces(FMF_BallPhysicsState &State, float DeltaTime)
+    {
+        // Gravity (only if not grounded)
+        if (!State.bIsGrounded)
+        {
+            State.Velocity.Z -= MF_Constants::Gravity * DeltaTime;
+        }
+
+        // Friction (ground friction when grounded, air resistance when flying)
+        const float FrictionCoeff = State.bIsGrounded ? MF_Constants::BallFriction : MF_Constants::BallAirResistance;
+
+        // Linear deceleration of XY velocity
+        FVector XYVelocity(State.Velocity.X, State.Velocity.Y, 0.0f);
+        if (!XYVelocity.IsNearlyZero())
+        {
+            const float CurrentSpeed = XYVelocity.Size();
+            const float NewSpeed = FMath::Max(0.0f, CurrentSpeed - FrictionCoeff * DeltaTime);
+
+            XYVelocity *= NewSpeed / CurrentSpeed;
+            State.Velocity.X = XYVelocity.X;
+            State.Velocity.Y = XYVelocity.Y;
+        }
+
+        // Angular velocity decay
+        State.AngularVelocity *= (1.0f - 2.0f * DeltaTime);
+    }
+
+    void ResolveGround(FMF_BallPhysicsState &State, float Radius)
+    {
+        const float GroundZ = MF_Constants::GroundZ + Radius;
+        if (State.Location.Z > GroundZ)
+        {
+            State.bIsGrounded = false;
+            return;
+        }
+
+        // Hit ground
+        if (!State.bIsGrounded && State.Velocity.Z < 0.0f)
+        {
+            const float BounceVelocity = -State.Velocity.Z * MF_Constants::BallBounciness;
+            if (BounceVelocity > MinBounceSpeed)
+            {
+                State.Velocity.Z = BounceVelocity;
+                State.bIsGrounded = false;
+            }
+            else
+            {
+                State.Velocity.Z = 0.0f;
+                State.bIsGrounded = true;
+            }
+        }
+
+        // Clamp to ground
+        State.Location.Z = GroundZ;
+    }
+
+    bool SettleIfAtRest(FMF_BallPhysicsState &State)
+    {
+        if (State.bIsGrounded && State.Velocity.SizeSquared() < FMath::Square(RestSpeed))
+        {
+            State.Velocity = FVector::ZeroVector;
+            State.AngularVelocity = FVector::ZeroVector;
+            return true;
+        }
+        return false;
+    }
+
+    bool Step(FMF_BallPhysicsState &State, float DeltaTime, float Radius)
+    {
+        ApplyForces(State, DeltaTime);
+        State.Location += State.Velocity * DeltaTime;
+        ResolveGround(State, Radius);
+        return SettleIfAtRest(State);
+    }
+
+    FMF_BallPhysicsState MakeKick(const FVector &Location, const FVector &Direction, float Power, bool bAddHeight)
+    {
+        const FVector KickDirection = Direction.GetSafeNormal();
+
+        FMF_BallPhysicsState State;
+        State.Location = Location;
+        State.Velocity = KickDirection * Power;
+        if (bAddHeight)
+        {
+            State.Velocity.Z += Power * 0.3f;
+        }
+        State.AngularVelocity = FVector::CrossProduct(FVector::UpVector, KickDirection) * (Power / 100.0f);
+        State.bIsGrounded = false;
+        return State;
+    }
+
+    float GetPassTime(const FVector &Location, const FVector &Point, float Power, float Radius)
+    {
+        const FVector Direction = (Point - Location).GetSafeNormal2D();
+        const FMF_BallTrajectory Path(MakeKick(Location, Direction, Power, false), Radius);
+
+        const float TravelTime = Path.GetTimeToReach(Point);
+        return TravelTime >= 0.0f ? TravelTime : Path.GetStopTime();
+    }
+}
+
+// ==================== FMF_BallTrajectory ====================
+
+FMF_BallTrajectory::FMF_BallTrajectory(const FMF_BallPhysicsState &State, float Radius)
+    : Start(State.Location), RestZ(MF_Constants::GroundZ + Radius)
+{
+    constexpr int32 MaxArcs = 16;
+    constexpr float G = MF_Constants::Gravity;
+
+    const FVector XYVelocity(State.Velocity.X, State.Velocity.Y, 0.0f);
+    Speed = XYVelocity.Size();
+    Direction = Speed > UE_KINDA_SMALL_NUMBER ? XYVelocity / Speed : FVector::ZeroVector;
+
+    // Vertical: arcs until a bounce comes out slower than MinBounceSpeed
+    if (!State.bIsGrounded)
+    {
+        float Time = 0.0f;
+        float Height = FMath::Max(0.0f, static_cast<float>(State.Location.Z) - RestZ);
+        float SpeedZ = State.Velocity.Z;
+
+        for (int32 Index = 0; Index < MaxArcs; ++Index)
+        {
+            Arcs.Add({Time, Height, SpeedZ});
+
+            const float ToGround = (SpeedZ + FMath::Sqrt(FMath::Square(SpeedZ) + 2.0f * G * Height)) / G;
+            Time += ToGround;
+            if (Index == 0)
+            {
+                LandingTime = Time;
+            }
+
+            const float Bounce = -(SpeedZ - G * ToGround) * MF_Constants::BallBounciness;
+            if (Bounce <= MF_BallPhysics::MinBounceSpeed)
+            {
+                break;
+            }
+            Height = 0.0f;
+            SpeedZ = Bounce;
+        }
+        SettleTime = Time;
+    }
+
+    // Horizontal: air deceleration while airborne, ground friction after
+    const float AirStop = Speed / MF_Constants::BallAirResistance;
+    if (AirStop <= SettleTime)
+    {
+        XYStopTime = AirStop;
+        SettleSpeed = 0.0f;
+        SettleDistance = FMath::Square(Speed) / (2.0f * MF_Constants::BallAirResistance);
+    }
+    else
+    {
+        SettleSpeed = Speed - MF_Constants::BallAirResistance * SettleTime;
+        SettleDistance = Speed * SettleTime - 0.5f * MF_Constants::BallAirResistance * FMath::Square(SettleTime);
+        XYStopTime = SettleTime + SettleSpeed / MF_Constants::BallFriction;
+    }
+
+    StopTime = FMath::Max(XYStopTime, SettleTime);
+}
+
+float FMF_BallTrajectory::GetDistanceAt(float Time) const
+{
+    if (Time <= SettleTime)
+    {
+        const float Airborne = FMath::Clamp(Time, 0.0f, FMath::Min(XYStopTime, SettleTime));
+        return Speed * Airborne - 0.5f * MF_Constants::BallAirResistance * FMath::Square(Airborne);
+    }
+
+    const float Rolling = FMath::Min(Time, XYStopTime) - SettleTime;
+    if (Rolling <= 0.0f)
+    {
+        return SettleDistance;
+    }
+    return SettleDistance + SettleSpeed * Rolling - 0.5f * MF_Constants::BallFriction * FMath::Square(Rolling);
+}
+
+float FMF_BallTrajectory::GetHeightAt(float Time) const
+{
+    if (Arcs.Num() == 0 || Time >= SettleTime)
+    {
+        return 0.0f;
+    }
+
+    int32 Index = Arcs.Num() - 1;
+    while (Index > 0 && Arcs[Index].StartTime > Time)
+    {
+        --Index;
+    }
+
+    const FArc &Arc = Arcs[Index];
+    const float Elapsed = FMath::Max(0.0f, Time - Arc.StartTime);
+    return FMath::Max(0.0f, Arc.StartHeight + Arc.StartSpeedZ * Elapsed - 0.5f * MF_Constants::Gravity * FMath::Square(Elapsed));
+}
+
+FVector FMF_BallTrajectory::GetPosition(float Time) const
+{
+    const float Clamped = FMath::Clamp(Time, 0.0f, StopTime);
+    FVector Position = Start + Direction * GetDistanceAt(Clamped);
+    Position.Z = RestZ + GetHeightAt(Clamped);
+    return Position;
+}
+
+float FMF_BallTrajectory::GetTimeAtDistance(float Distance) const
+{
+    if (Distance < 0.0f || Distance > GetDistanceAt(XYStopTime) || Speed <= UE_KINDA_SMALL_NUMBER)
+    {
+        return -1.0f;
+    }
+
+    // Invert s = v t - a t^2 / 2 on the phase that contains Distance
+    if (Distance <= SettleDistance || SettleSpeed <= 0.0f)
+    {
+        const float Root = FMath::Sqrt(FMath::Max(0.0f, FMath::Square(Speed) - 2.0f * MF_Constants::BallAirResistance * Distance));
+        return (Speed - Root) / MF_Constants::BallAirResistance;
+    }
+
+    const float Remaining = Distance - SettleDistance;
+    const float Root = FMath::Sqrt(FMath::Max(0.0f, FMath::Square(SettleSpeed) - 2.0f * MF_Constants::BallFriction * Remaining));
+    return SettleTime + (SettleSpeed - Root) / MF_Constants::BallFriction;
+}
+
+float FMF_BallTrajectory::GetTimeToReach(const FVector &Point) const
+{
+    const FVector ToPoint(Point.X - Start.X, Point.Y - Start.Y, 0.0f);
+    return GetTimeAtDistance(FVector::DotProduct(ToPoint, Direction));
+}
@@ -0,0 +1,144 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: MF_BallPhysics - Pure fixed-step ball integrator + closed-form trajectory
+ *               Gravity, linear ground/air friction and ground bounces on a plain state struct,
+ *               shared by AMF_Ball and anything that needs to replay or predict its model
+ * @Date: 16/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/MF_Types.h"
+
+/**
+ * Kinematic ball state. No actor, no components - safe to copy and step anywhere.
+ */
+struct FMF_BallPhysicsState
+{
+    FVector Location = FVector::ZeroVector;
+    FVector Velocity = FVector::ZeroVector;
+    FVector AngularVelocity = FVector::ZeroVector;
+    bool bIsGrounded = true;
+};
+
+/**
+ * FMF_FixedStepper
+ * Frame-time accumulator: turns a variable frame DeltaTime into a whole number of
+ * fixed steps plus a render interpolation alpha. Time beyond MaxSteps is dropped
+ * so a long hitch cannot snowball into ever longer frames.
+ */
+struct FMF_FixedStepper
+{
+    float Accumulator = 0.0f;
+
+    /** Add DeltaTime and return how many StepDt steps to run this frame */
+    int32 Advance(float DeltaTime, float StepDt, int32 MaxSteps)
+    {
+        Accumulator += DeltaTime;
+        const int32 Steps = FMath::Min(FMath::FloorToInt32(Accumulator / StepDt), MaxSteps);
+        Accumulator = (Steps == MaxSteps) ? FMath::Min(Accumulator - Steps * StepDt, StepDt) : Accumulator - Steps * StepDt;
+        return Steps;
+    }
+
+    /** Fraction of a step left over, for blending previous -> current state */
+    float GetAlpha(float StepDt) const { return FMath::Clamp(Accumulator / StepDt, 0.0f, 1.0f); }
+
+    void Reset() { Accumulator = 0.0f; }
+};
+
+namespace MF_BallPhysics
+{
+    /** Minimum upward speed after a bounce; slower impacts settle on the ground (cm/s) */
+    constexpr float MinBounceSpeed = 50.0f;
+
+    /** Grounded balls slower than this come to rest (cm/s) */
+    constexpr float RestSpeed = MF_Constants::BallMinSpeed;
+
+    /** Gravity (airborne only), friction on XY and spin decay */
+    P_MINIFOOTBALL_API void ApplyForces(FMF_BallPhysicsState &State, float DeltaTime);
+
+    /** Bounce or settle if the ball is at/below the ground; clamps Z to Radius above GroundZ */
+    P_MINIFOOTBALL_API void ResolveGround(FMF_BallPhysicsState &State, float Radius);
+
+    /** Zero velocity if grounded and slower than RestSpeed; returns true if the ball is at rest */
+    P_MINIFOOTBALL_API bool SettleIfAtRest(FMF_BallPhysicsState &State);
+
+    /** One fixed step: forces, position integration, ground contact, rest check */
+    P_MINIFOOTBALL_API bool Step(FMF_BallPhysicsState &State, float DeltaTime, float Radius);
+
+    /**
+     * State AMF_Ball::Kick launches from Location: airborne, Direction * Power, plus 30% of Power
+     * upward when bAddHeight (shots). Passes are kicked flat from carry height, so they fly under
+     * air drag until they land.
+     */
+    P_MINIFOOTBALL_API FMF_BallPhysicsState MakeKick(const FVector &Location, const FVector &Direction, float Power, bool bAddHeight);
+}
+
+/**
+ * FMF_BallTrajectory
+ * Closed-form solution of the MF_BallPhysics model from one state: parabolic arcs with
+ * restitution until the bounce dies out, air deceleration on XY while airborne, ground
+ * friction after. The XY path is a straight line, so distance along it is monotonic.
+ * Walls, goals and players are ignored. Matches the fixed-step integrator to within a
+ * step's worth of travel; build once and query many times.
+ */
+struct P_MINIFOOTBALL_API FMF_BallTrajectory
+{
+    FMF_BallTrajectory(const FMF_BallPhysicsState &State, float Radius);
+
+    /** Position Time seconds from now (clamped to the stop point) */
+    FVector GetPosition(float Time) const;
+
+    /** Distance travelled along the XY path after Time seconds */
+    float GetDistanceAt(float Time) const;
+
+    /** Seconds until the ball has travelled Distance along its XY path; -1 if it stops first */
+    float GetTimeAtDistance(float Distance) const;
+
+    /** Seconds until the ball passes Point's projection onto its XY path; -1 if behind it or it stops first */
+    float GetTimeToReach(const FVector &Point) const;
+
+    /** First ground contact (now, if already grounded) */
+    float GetLandingTime() const { return LandingTime; }
+    FVector GetLandingPoint() const { return GetPosition(LandingTime); }
+
+    /** Ball fully at rest */
+    float GetStopTime() const { return StopTime; }
+    FVector GetStopPoint() const { return GetPosition(StopTime); }
+
+    /** Unit XY direction of travel (zero if not moving horizontally) */
+    const FVector &GetDirection() const { return Direction; }
+
+private:
+    float GetHeightAt(float Time) const;
+
+    /** One airborne arc: height above rest and vertical speed at its start */
+    struct FArc
+    {
+        float StartTime;
+        float StartHeight;
+        float StartSpeedZ;
+    };
+
+    FVector Start;
+    FVector Direction;
+    float RestZ;
+    float Speed;
+
+    /** Airborne arcs end (and ground friction takes over) at SettleTime */
+    TArray<FArc, TInlineAllocator<8>> Arcs;
+    float SettleTime = 0.0f;
+    float SettleSpeed = 0.0f;
+    float SettleDistance = 0.0f;
+
+    float XYStopTime = 0.0f;
+    float LandingTime = 0.0f;
+    float StopTime = 0.0f;
+};
+
+namespace MF_BallPhysics
+{
+    /** Seconds for a flat pass kicked from Location at Power to reach Point (its stop time if it stops short) */
+    P_MINIFOOTBALL_API float GetPassTime(const FVector &Location, const FVector &Point, float Power, float Radius);
+}
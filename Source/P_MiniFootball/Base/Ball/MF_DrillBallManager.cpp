@@ -0,0 +1,299 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: MF_DrillBallManager - Implementation
+ * @Date: 16/10/2026
+ */
+
+#include "Ball/MF_DrillBallManager.h"
+#include "Match/MF_FieldLandmarks.h"
+#include "Core/MF_Stats.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "GameFramework/GameStateBase.h"
+#include "Net/UnrealNetwork.h"
+#include "Net/Core/PushModel/PushModel.h"
+
+DEFINE_STAT(STAT_MF_DrillBallSteps);
+DECLARE_CYCLE_STAT(TEXT("Drill Ball Kernel"), STAT_MF_DrillBallKernel, STATGROUP_MiniFootball);
+
+AMF_DrillBallManager::AMF_DrillBallManager()
+{
+    PrimaryActorTick.bCanEverTick = true;
+
+    BallInstances = CreateDefaultSubobject<UInstancedStaticMeshComponent>(TEXT("BallInstances"));
+    BallInstances->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+    BallInstances->SetGenerateOverlapEvents(false);
+    BallInstances->SetMobility(EComponentMobility::Movable);
+    RootComponent = BallInstances;
+
+    // Network settings
+    bReplicates = true;
+    bAlwaysRelevant = true;
+    SetNetUpdateFrequency(MF_Constants::NetUpdateFrequency);
+    SetMinNetUpdateFrequency(MF_Constants::MinNetUpdateFrequency);
+}
+
+void AMF_DrillBallManager::GetLifetimeReplicatedProps(TArray<FLifetimeProperty> &OutLifetimeProps) const
+{
+    Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+    FDoRepLifetimeParams Params;
+    Params.bIsPushBased = true;
+
+    DOREPLIFETIME_WITH_PARAMS_FAST(AMF_DrillBallManager, Balls, Params);
+}
+
+void AMF_DrillBallManager::BeginPlay()
+{
+    Super::BeginPlay();
+
+    SimTime = GetWorld()->GetTimeSeconds();
+}
+
+void AMF_DrillBallManager::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    const bool bRenders = GetNetMode() != NM_DedicatedServer;
+    const FVector Scale(BallRadius / 50.0f); // Same mesh scale as AMF_Ball
+    TransformScratch.Reset();
+
+    if (HasAuthority())
+    {
+        StepDrill(DeltaTime);
+        PublishBalls();
+
+        if (bRenders)
+        {
+            // Render between the last two steps
+            const float Alpha = Stepper.GetAlpha(1.0f / FMath::Max(PhysicsStepRate, 1.0f));
+            for (int32 Index = 0; Index < Batch.Num(); ++Index)
+            {
+                TransformScratch.Emplace(FQuat::Identity, FMath::Lerp(Batch.GetPrevLocation(Index), Batch.GetLocation(Index), Alpha), Scale);
+            }
+        }
+    }
+    else
+    {
+        // Dead-reckon every ball from its last replicated state
+        const AGameStateBase *GameState = GetWorld()->GetGameState();
+        const float ServerNow = GameState ? GameState->GetServerWorldTimeSeconds() : GetWorld()->GetTimeSeconds();
+        for (int32 Index = 0; Index < ClientTrajectories.Num(); ++Index)
+        {
+            const FVector Location = ClientTrajectories[Index].IsSet()
+                                         ? ClientTrajectories[Index]->GetPosition(ServerNow - ClientTimestamps[Index])
+                                         : Balls[Index].Location;
+            TransformScratch.Emplace(FQuat::Identity, Location, Scale);
+        }
+    }
+
+    if (bRenders)
+    {
+        UpdateInstances();
+    }
+}
+
+// ==================== Drill API ====================
+
+int32 AMF_DrillBallManager::SpawnDrillBall(FVector Location)
+{
+    if (!HasAuthority() || Batch.Num() >= MaxBalls)
+    {
+        return INDEX_NONE;
+    }
+
+    Location.Z = FMath::Max(static_cast<float>(Location.Z), MF_Constants::GroundZ + BallRadius);
+    const int32 Index = Batch.Add(Location);
+    SpawnLocations.Add(Location);
+    PublishedTrajectories.AddDefaulted();
+    Balls.AddDefaulted();
+    MARK_PROPERTY_DIRTY_FROM_NAME(AMF_DrillBallManager, Balls, this);
+    return Index;
+}
+
+void AMF_DrillBallManager::KickDrillBall(int32 BallIndex, FVector NewVelocity)
+{
+    if (!HasAuthority() || !SpawnLocations.IsValidIndex(BallIndex))
+    {
+        return;
+    }
+
+    Batch.SetVelocity(BallIndex, NewVelocity);
+    PublishedTrajectories[BallIndex].Reset();
+}
+
+void AMF_DrillBallManager::ResetDrillBall(int32 BallIndex)
+{
+    if (!HasAuthority() || !SpawnLocations.IsValidIndex(BallIndex))
+    {
+        return;
+    }
+
+    Batch.SetLocation(BallIndex, SpawnLocations[BallIndex]);
+    PublishedTrajectories[BallIndex].Reset();
+}
+
+void AMF_DrillBallManager::ClearDrillBalls()
+{
+    if (!HasAuthority())
+    {
+        return;
+    }
+
+    Batch.Reset();
+    SpawnLocations.Reset();
+    PublishedTrajectories.Reset();
+    Balls.Reset();
+    MARK_PROPERTY_DIRTY_FROM_NAME(AMF_DrillBallManager, Balls, this);
+}
+
+// ==================== Queries ====================
+
+FVector AMF_DrillBallManager::GetDrillBallLocation(int32 BallIndex) const
+{
+    if (HasAuthority())
+    {
+        return SpawnLocations.IsValidIndex(BallIndex) ? Batch.GetLocation(BallIndex) : FVector::ZeroVector;
+    }
+
+    if (!ClientTrajectories.IsValidIndex(BallIndex) || !ClientTrajectories[BallIndex].IsSet())
+    {
+        return Balls.IsValidIndex(BallIndex) ? Balls[BallIndex].Location : FVector::ZeroVector;
+    }
+
+    const AGameStateBase *GameState = GetWorld()->GetGameState();
+    const float ServerNow = GameState ? GameState->GetServerWorldTimeSeconds() : GetWorld()->GetTimeSeconds();
+    return ClientTrajectories[BallIndex]->GetPosition(ServerNow - ClientTimestamps[BallIndex]);
+}
+
+int32 AMF_DrillBallManager::FindNearestDrillBall(FVector Location, float MaxDistance) const
+{
+    int32 BestIndex = INDEX_NONE;
+    float BestDistSq = FMath::Square(MaxDistance);
+
+    for (int32 Index = 0; Index < Balls.Num(); ++Index)
+    {
+        const float DistSq = FVector::DistSquared(GetDrillBallLocation(Index), Location);
+        if (DistSq <= BestDistSq)
+        {
+            BestIndex = Index;
+            BestDistSq = DistSq;
+        }
+    }
+    return BestIndex;
+}
+
+// ==================== Simulation ====================
+
+void AMF_DrillBallManager::StepDrill(float DeltaTime)
+{
+    SCOPE_CYCLE_COUNTER(STAT_MF_DrillBallKernel);
+
+    const float StepDt = 1.0f / FMath::Max(PhysicsStepRate, 1.0f);
+    const int32 Steps = Stepper.Advance(DeltaTime, StepDt, FMath::Max(MaxPhysicsSubsteps, 1));
+    const FMF_FieldLandmarks &Landmarks = UMF_FieldLandmarksSubsystem::GetLandmarks(this);
+
+    for (int32 Step = 0; Step < Steps; ++Step)
+    {
+        SimTime += StepDt;
+        [[maybe_unused]] const int32 Simulated = Batch.Step(StepDt, BallRadius);
+        INC_DWORD_STAT_BY(STAT_MF_DrillBallSteps, Simulated);
+
+        Batch.SweepBoundaries(Landmarks, BallRadius, CrossingScratch);
+        for (const FMF_BallBatchCrossing &Result : CrossingScratch)
+        {
+            // Event handlers may clear or reset balls
+            if (!SpawnLocations.IsValidIndex(Result.Index))
+            {
+                continue;
+            }
+
+            switch (Result.Crossing.Type)
+            {
+            case EMF_BallCrossing::Touchline:
+                // Rebound off the side boards, same as AMF_Ball
+                Batch.PosX[Result.Index] = 2.0f * static_cast<float>(Result.Crossing.Point.X) - Batch.PosX[Result.Index];
+                Batch.VelX[Result.Index] *= -MF_Constants::BallBounciness;
+                PublishedTrajectories[Result.Index].Reset();
+                break;
+            case EMF_BallCrossing::Goal:
+                ResetDrillBall(Result.Index);
+                OnDrillGoal.Broadcast(this, Result.Index, FMF_FieldLandmarks::Opponent(Result.Crossing.LineTeam));
+                break;
+            case EMF_BallCrossing::GoalLine:
+                ResetDrillBall(Result.Index);
+                OnDrillBallOut.Broadcast(this, Result.Index);
+                break;
+            default:
+                break;
+            }
+        }
+    }
+}
+
+void AMF_DrillBallManager::PublishBalls()
+{
+    const float ToleranceSq = FMath::Square(ReplicationErrorTolerance);
+    bool bPublished = false;
+
+    for (int32 Index = 0; Index < Batch.Num(); ++Index)
+    {
+        const FMF_BallPhysicsState State = Batch.GetState(Index);
+        FMF_BallReplicationData &Data = Balls[Index];
+        TOptional<FMF_BallTrajectory> &Published = PublishedTrajectories[Index];
+
+        // Clients extrapolate the last published state; only correct them once they drift
+        if (Published.IsSet() && FVector::DistSquared(Published->GetPosition(SimTime - Data.ServerTimestamp), State.Location) <= ToleranceSq)
+        {
+            continue;
+        }
+
+        Data.Location = State.Location;
+        Data.Velocity = State.Velocity;
+        Data.bIsGrounded = State.bIsGrounded;
+        Data.State = Batch.Sleeping[Index] ? EMF_BallState::Loose : EMF_BallState::InFlight;
+        Data.ServerTimestamp = SimTime;
+        Published.Emplace(State, BallRadius);
+        bPublished = true;
+    }
+
+    if (bPublished)
+    {
+        MARK_PROPERTY_DIRTY_FROM_NAME(AMF_DrillBallManager, Balls, this);
+    }
+}
+
+void AMF_DrillBallManager::OnRep_Balls()
+{
+    const AGameStateBase *GameState = GetWorld()->GetGameState();
+    const float ServerNow = GameState ? GameState->GetServerWorldTimeSeconds() : GetWorld()->GetTimeSeconds();
+
+    ClientTrajectories.SetNum(Balls.Num());
+    ClientTimestamps.SetNum(Balls.Num());
+
+    for (int32 Index = 0; Index < Balls.Num(); ++Index)
+    {
+        const FMF_BallReplicationData &Data = Balls[Index];
+
+        FMF_BallPhysicsState State;
+        State.Location = Data.Location;
+        State.Velocity = Data.Velocity;
+        State.bIsGrounded = Data.bIsGrounded;
+        ClientTrajectories[Index].Emplace(State, BallRadius);
+        ClientTimestamps[Index] = FMF_BallReplicationData::UnwrapTimestamp(Data.ServerTimestamp, ServerNow);
+    }
+}
+
+void AMF_DrillBallManager::UpdateInstances()
+{
+    if (BallInstances->GetInstanceCount() != TransformScratch.Num())
+    {
+        BallInstances->ClearInstances();
+        BallInstances->AddInstances(TransformScratch, false, true);
+        return;
+    }
+
+    if (TransformScratch.Num() > 0)
+    {
+        BallInstances->BatchUpdateInstancesTransforms(0, TransformScratch, true, true, true);
+    }
+}
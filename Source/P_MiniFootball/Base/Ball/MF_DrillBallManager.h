@@ -0,0 +1,143 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: MF_DrillBallManager - Many-ball training drills on one actor
+ *               One batched SoA simulation (FMF_BallBatch) on the server,
+ *               instanced-mesh proxies dead-reckoned on clients
+ * @Date: 16/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "Core/MF_Types.h"
+#include "Ball/MF_BallBatch.h"
+#include "Ball/MF_BallPhysics.h"
+#include "MF_DrillBallManager.generated.h"
+
+class UInstancedStaticMeshComponent;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnDrillGoal, AMF_DrillBallManager *, Manager, int32, BallIndex, EMF_TeamID, ScoringTeam);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnDrillBallOut, AMF_DrillBallManager *, Manager, int32, BallIndex);
+
+/**
+ * MF_DrillBallManager - Drill mode ball pool (shooting drills, passing squares, GK practice)
+ *
+ * Features:
+ * - Up to MaxBalls balls with no per-ball actor, tick or collision component
+ * - Server: one fixed-step batch kernel for integration and ground bounce, a bounds-only
+ *   broad phase before the swept goal-line / touchline test, one instance transform update
+ * - Clients: one FMF_BallReplicationData per ball (send-on-drift, like AMF_Ball), each
+ *   extrapolated along its FMF_BallTrajectory into a shared instanced mesh
+ * - Balls that go out or into a goal return to their spawn spot
+ *
+ * Drill balls are not possessable; drill logic kicks them through KickDrillBall.
+ */
+UCLASS()
+class P_MINIFOOTBALL_API AMF_DrillBallManager : public AActor
+{
+    GENERATED_BODY()
+
+public:
+    AMF_DrillBallManager();
+
+    virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty> &OutLifetimeProps) const override;
+
+    // ==================== Components ====================
+    /** One instance per drill ball (visual only, no collision) */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
+    UInstancedStaticMeshComponent *BallInstances;
+
+    // ==================== Configuration ====================
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Drill", meta = (ClampMin = "1", ClampMax = "256"))
+    int32 MaxBalls = 64;
+
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Physics")
+    float BallRadius = MF_Constants::BallRadius;
+
+    /** Fixed simulation rate (steps per second) */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Physics", meta = (ClampMin = "15", ClampMax = "480"))
+    float PhysicsStepRate = 120.0f;
+
+    /** Max fixed steps per frame; time beyond this is dropped after a hitch */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Physics", meta = (ClampMin = "1", ClampMax = "32"))
+    int32 MaxPhysicsSubsteps = 8;
+
+    /** A ball is republished once clients' extrapolation of it is off by more than this (cm) */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Network", meta = (ClampMin = "0.5"))
+    float ReplicationErrorTolerance = 10.0f;
+
+    // ==================== Drill API (Server) ====================
+    /** Add a ball at rest; returns its index (INDEX_NONE when MaxBalls are out) */
+    UFUNCTION(BlueprintCallable, Category = "Drill")
+    int32 SpawnDrillBall(FVector Location);
+
+    /** Give a ball a velocity (cm/s) */
+    UFUNCTION(BlueprintCallable, Category = "Drill")
+    void KickDrillBall(int32 BallIndex, FVector NewVelocity);
+
+    /** Put a ball back on its spawn spot */
+    UFUNCTION(BlueprintCallable, Category = "Drill")
+    void ResetDrillBall(int32 BallIndex);
+
+    /** Remove every ball */
+    UFUNCTION(BlueprintCallable, Category = "Drill")
+    void ClearDrillBalls();
+
+    // ==================== Queries ====================
+    UFUNCTION(BlueprintPure, Category = "Drill")
+    int32 GetNumDrillBalls() const { return Balls.Num(); }
+
+    /** Latest known location of a ball (simulated on the server, extrapolated on clients) */
+    UFUNCTION(BlueprintPure, Category = "Drill")
+    FVector GetDrillBallLocation(int32 BallIndex) const;
+
+    /** Closest ball to Location within MaxDistance (INDEX_NONE if none) */
+    UFUNCTION(BlueprintPure, Category = "Drill")
+    int32 FindNearestDrillBall(FVector Location, float MaxDistance) const;
+
+    // ==================== Events ====================
+    UPROPERTY(BlueprintAssignable, Category = "Events")
+    FOnDrillGoal OnDrillGoal;
+
+    UPROPERTY(BlueprintAssignable, Category = "Events")
+    FOnDrillBallOut OnDrillBallOut;
+
+protected:
+    virtual void BeginPlay() override;
+    virtual void Tick(float DeltaTime) override;
+
+    UFUNCTION()
+    void OnRep_Balls();
+
+    /** Per-ball state as clients receive it (changed elements only) */
+    UPROPERTY(ReplicatedUsing = OnRep_Balls)
+    TArray<FMF_BallReplicationData> Balls;
+
+private:
+    /** Server: fixed steps over the whole batch, boundary handling */
+    void StepDrill(float DeltaTime);
+
+    /** Server: republish balls whose client extrapolation drifted */
+    void PublishBalls();
+
+    /** Write every proxy transform (TransformScratch) in one batch, resizing the instance list if needed */
+    void UpdateInstances();
+
+    /** Server simulation */
+    FMF_BallBatch Batch;
+    FMF_FixedStepper Stepper;
+    float SimTime = 0.0f;
+    TArray<FVector> SpawnLocations;
+    TArray<FMF_BallBatchCrossing> CrossingScratch;
+
+    /** Server: trajectory of each ball's last published state (unset = publish next tick) */
+    TArray<TOptional<FMF_BallTrajectory>> PublishedTrajectories;
+
+    /** Client: trajectory and unwrapped timestamp of each replicated ball */
+    TArray<TOptional<FMF_BallTrajectory>> ClientTrajectories;
+    TArray<float> ClientTimestamps;
+
+    /** Reused for instance updates */
+    TArray<FTransform> TransformScratch;
+};
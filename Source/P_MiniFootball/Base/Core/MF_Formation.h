@@ -23,6 +23,49 @@ enum class EMF_PlayerRole : uint8
     None UMETA(DisplayName = "None")
 };
 
+namespace MF_Roles
+{
+    /** Resolve a role from an AI profile name (profile names embed the role, e.g. "Goalkeeper") */
+    inline EMF_PlayerRole FromProfileName(const FString &ProfileName)
+    {
+        if (ProfileName.Contains(TEXT("Goalkeeper")))
+        {
+            return EMF_PlayerRole::Goalkeeper;
+        }
+        if (ProfileName.Contains(TEXT("Defender")))
+        {
+            return EMF_PlayerRole::Defender;
+        }
+        if (ProfileName.Contains(TEXT("Midfielder")))
+        {
+            return EMF_PlayerRole::Midfielder;
+        }
+        if (ProfileName.Contains(TEXT("Striker")))
+        {
+            return EMF_PlayerRole::Striker;
+        }
+        return EMF_PlayerRole::None;
+    }
+
+    /** Stock AI profile name for a role (inverse of FromProfileName; empty for None) */
+    inline FString ToProfileName(EMF_PlayerRole Role)
+    {
+        switch (Role)
+        {
+        case EMF_PlayerRole::Goalkeeper:
+            return TEXT("Goalkeeper");
+        case EMF_PlayerRole::Defender:
+            return TEXT("Defender");
+        case EMF_PlayerRole::Midfielder:
+            return TEXT("Midfielder");
+        case EMF_PlayerRole::Striker:
+            return TEXT("Striker");
+        default:
+            return FString();
+        }
+    }
+}
+
 /**
  * Formation slot data - defines a single position in the formation
  */
@@ -0,0 +1,274 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: MF_PlayerSnapshotSubsystem - Implementation
+ * @Date: 16/10/2026
+ */
+
+#include "Core/MF_PlayerSnapshotSubsystem.h"
+#include "Player/MF_PlayerCharacter.h"
+#include "Ball/MF_Ball.h"
+#include "Match/MF_FieldLandmarks.h"
+#include "Engine/World.h"
+
+void FMF_PlayerSnapshot::Reset()
+{
+    Characters.Reset();
+    Positions.Reset();
+    Velocities.Reset();
+    Teams.Reset();
+    Roles.Reset();
+    HasBall.Reset();
+    Stunned.Reset();
+    PlayerIDs.Reset();
+    MatchSlots.Reset();
+    IndexBySlot.Reset();
+    Grid.Reset();
+    BallChaseTimes.Reset();
+    BallChaseRanks.Reset();
+    for (TArray<int32> &Order : ChaseOrder)
+    {
+        Order.Reset();
+    }
+
+    CarrierIndex = INDEX_NONE;
+    Ball = nullptr;
+    BallLocation = FVector::ZeroVector;
+    BallVelocity = FVector::ZeroVector;
+}
+
+int32 FMF_PlayerSnapshot::IndexOf(const AMF_PlayerCharacter *Character) const
+{
+    if (!Character)
+    {
+        return INDEX_NONE;
+    }
+
+    const int32 Index = IndexOfSlot(Character->GetMatchSlot());
+    if (Index != INDEX_NONE)
+    {
+        return Index;
+    }
+
+    // Not spawned by the game mode (no slot): only a handful of these, if any
+    return Characters.IndexOfByKey(Character);
+}
+
+UMF_PlayerSnapshotSubsystem *UMF_PlayerSnapshotSubsystem::Get(const UObject *WorldContextObject)
+{
+    const UWorld *World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    return World ? World->GetSubsystem<UMF_PlayerSnapshotSubsystem>() : nullptr;
+}
+
+void UMF_PlayerSnapshotSubsystem::Deinitialize()
+{
+    RegisteredPlayers.Reset();
+    PlayersBySlot.Reset();
+    RegisteredBalls.Reset();
+    Snapshot.Reset();
+    Invalidate();
+
+    Super::Deinitialize();
+}
+
+// ==================== Registration ====================
+
+void UMF_PlayerSnapshotSubsystem::RegisterPlayer(AMF_PlayerCharacter *Character)
+{
+    if (Character)
+    {
+        RegisteredPlayers.AddUnique(Character);
+        ClearSlotOf(Character);
+
+        const uint8 Slot = Character->GetMatchSlot();
+        if (Slot != MF_Constants::InvalidMatchSlot)
+        {
+            if (Slot >= PlayersBySlot.Num())
+            {
+                PlayersBySlot.SetNum(Slot + 1);
+            }
+            PlayersBySlot[Slot] = Character;
+        }
+        Invalidate();
+    }
+}
+
+void UMF_PlayerSnapshotSubsystem::UnregisterPlayer(AMF_PlayerCharacter *Character)
+{
+    RegisteredPlayers.Remove(Character);
+    ClearSlotOf(Character);
+    Invalidate();
+}
+
+void UMF_PlayerSnapshotSubsystem::ClearSlotOf(const AMF_PlayerCharacter *Character)
+{
+    for (TWeakObjectPtr<AMF_PlayerCharacter> &Entry : PlayersBySlot)
+    {
+        if (Entry.Get() == Character)
+        {
+            Entry.Reset();
+        }
+    }
+}
+
+void UMF_PlayerSnapshotSubsystem::RegisterBall(AMF_Ball *Ball)
+{
+    if (Ball)
+    {
+        RegisteredBalls.AddUnique(Ball);
+        Invalidate();
+    }
+}
+
+void UMF_PlayerSnapshotSubsystem::UnregisterBall(AMF_Ball *Ball)
+{
+    RegisteredBalls.Remove(Ball);
+    Invalidate();
+}
+
+// ==================== Snapshot ====================
+
+const FMF_PlayerSnapshot &UMF_PlayerSnapshotSubsystem::GetSnapshot()
+{
+    if (BuiltFrame != GFrameCounter)
+    {
+        RebuildSnapshot();
+        BuiltFrame = GFrameCounter;
+    }
+    return Snapshot;
+}
+
+void UMF_PlayerSnapshotSubsystem::RebuildSnapshot()
+{
+    Snapshot.Reset();
+
+    RegisteredPlayers.RemoveAllSwap([](const TWeakObjectPtr<AMF_PlayerCharacter> &Player)
+                                    { return !Player.IsValid(); });
+    RegisteredBalls.RemoveAllSwap([](const TWeakObjectPtr<AMF_Ball> &Ball)
+                                  { return !Ball.IsValid(); });
+
+    const int32 Count = RegisteredPlayers.Num();
+    Snapshot.Characters.Reserve(Count);
+    Snapshot.Positions.Reserve(Count);
+    Snapshot.Velocities.Reserve(Count);
+    Snapshot.Teams.Reserve(Count);
+    Snapshot.Roles.Reserve(Count);
+    Snapshot.HasBall.Reserve(Count);
+    Snapshot.Stunned.Reserve(Count);
+    Snapshot.PlayerIDs.Reserve(Count);
+    Snapshot.MatchSlots.Reserve(Count);
+    Snapshot.IndexBySlot.Init(INDEX_NONE, PlayersBySlot.Num());
+
+    for (const TWeakObjectPtr<AMF_PlayerCharacter> &PlayerPtr : RegisteredPlayers)
+    {
+        AMF_PlayerCharacter *Player = PlayerPtr.Get();
+        const int32 Index = Snapshot.Characters.Add(Player);
+
+        Snapshot.Positions.Add(Player->GetActorLocation());
+        Snapshot.Velocities.Add(Player->GetVelocity());
+        Snapshot.Teams.Add(Player->GetTeamID());
+        Snapshot.Roles.Add(Player->GetPlayerRole());
+        Snapshot.HasBall.Add(Player->HasBall());
+        Snapshot.Stunned.Add(Player->IsStunned());
+        Snapshot.PlayerIDs.Add(Player->GetPlayerID());
+        Snapshot.MatchSlots.Add(Player->GetMatchSlot());
+        if (Snapshot.IndexBySlot.IsValidIndex(Player->GetMatchSlot()))
+        {
+            Snapshot.IndexBySlot[Player->GetMatchSlot()] = Index;
+        }
+
+        if (Snapshot.CarrierIndex == INDEX_NONE && Player->HasBall())
+        {
+            Snapshot.CarrierIndex = Index;
+        }
+    }
+
+    Snapshot.Grid.Build(Snapshot.Positions, Snapshot.Teams);
+
+    if (RegisteredBalls.Num() > 0)
+    {
+        Snapshot.Ball = RegisteredBalls[0].Get();
+        Snapshot.BallLocation = Snapshot.Ball->GetActorLocation();
+        Snapshot.BallVelocity = Snapshot.Ball->IsPossessed() ? FVector::ZeroVector : Snapshot.Ball->Velocity;
+    }
+
+    BuildBallChaseRanking();
+}
+
+// ==================== Ball Chase Ranking ====================
+
+void UMF_PlayerSnapshotSubsystem::BuildBallChaseRanking()
+{
+    // Time to turn and accelerate when running directly away from the ball
+    constexpr float TurnTime = 0.3f;
+    // Don't extrapolate ball travel further than this (ignores friction)
+    constexpr float MaxPredictionTime = 1.5f;
+    // Striker aggression: reach the ball "15% sooner"
+    constexpr float StrikerWeight = 0.85f;
+
+    const FMF_FieldLandmarks &Landmarks = UMF_FieldLandmarksSubsystem::GetLandmarks(this);
+
+    const int32 Count = Snapshot.Num();
+    Snapshot.BallChaseTimes.Init(MAX_flt, Count);
+    Snapshot.BallChaseRanks.Init(INDEX_NONE, Count);
+
+    if (!Snapshot.Ball)
+    {
+        return;
+    }
+
+    const FVector &BallPos = Snapshot.BallLocation;
+    const float Speed = MF_Constants::SprintSpeed;
+
+    for (int32 Index = 0; Index < Count; ++Index)
+    {
+        const FVector From = Snapshot.Positions[Index];
+
+        // Intercept estimate: refine the target to where the ball will be on arrival
+        FVector Target = BallPos;
+        float Time = FVector::Dist2D(From, Target) / Speed;
+        for (int32 Iteration = 0; Iteration < 2; ++Iteration)
+        {
+            Target = BallPos + Snapshot.BallVelocity * FMath::Min(Time, MaxPredictionTime);
+            Time = FVector::Dist2D(From, Target) / Speed;
+        }
+
+        // Players already running toward the target get there sooner than ones facing away
+        const FVector ToTarget = (Target - From).GetSafeNormal2D();
+        const float Along = FMath::Clamp(FVector::DotProduct(Snapshot.Velocities[Index], ToTarget) / Speed, -1.0f, 1.0f);
+        Time += TurnTime * 0.5f * (1.0f - Along);
+
+        // Role weighting (same rules the per-agent scan used)
+        const EMF_PlayerRole Role = Snapshot.Roles[Index];
+        if (Role == EMF_PlayerRole::Striker)
+        {
+            Time *= StrikerWeight;
+        }
+        else if (Role == EMF_PlayerRole::Goalkeeper)
+        {
+            // Goalkeepers are hyper aggressive inside their own penalty box and stay in goal otherwise
+            if (EnumHasAnyFlags(Landmarks.GetZones(Snapshot.Teams[Index], BallPos), EMF_PitchZone::OwnBox))
+            {
+                Time *= 0.1f; // Massive priority
+            }
+            else
+            {
+                Time *= 2.0f;
+            }
+        }
+
+        Snapshot.BallChaseTimes[Index] = Time;
+        Snapshot.ChaseOrder[static_cast<uint8>(Snapshot.Teams[Index])].Add(Index);
+    }
+
+    for (TArray<int32> &Order : Snapshot.ChaseOrder)
+    {
+        const TArray<float> &Times = Snapshot.BallChaseTimes;
+        Order.Sort([&Times](int32 A, int32 B)
+                   { return Times[A] < Times[B]; });
+
+        for (int32 Rank = 0; Rank < Order.Num(); ++Rank)
+        {
+            Snapshot.BallChaseRanks[Order[Rank]] = Rank;
+        }
+    }
+}
@@ -0,0 +1,163 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: MF_PlayerSnapshotSubsystem - Per-frame structure-of-arrays snapshot of all players
+ *               Built once per frame on first access and shared by AI perception, targeting,
+ *               tackling and ball pickup instead of each walking the actor list.
+ *               Also carries the per-team ball-chase ranking (who goes to the ball)
+ * @Date: 16/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Core/MF_Types.h"
+#include "Core/MF_Formation.h"
+#include "Core/MF_SpatialGrid.h"
+#include "MF_PlayerSnapshotSubsystem.generated.h"
+
+class AMF_PlayerCharacter;
+class AMF_Ball;
+
+/**
+ * FMF_PlayerSnapshot
+ * Flat, index-aligned view of every registered player for one frame.
+ * Index i refers to the same player in every array.
+ */
+struct P_MINIFOOTBALL_API FMF_PlayerSnapshot
+{
+    TArray<AMF_PlayerCharacter *> Characters;
+    TArray<FVector> Positions;
+    TArray<FVector> Velocities;
+    TArray<EMF_TeamID> Teams;
+    TArray<EMF_PlayerRole> Roles;
+    TArray<bool> HasBall;
+    TArray<bool> Stunned;
+    TArray<uint8> PlayerIDs;
+    TArray<uint8> MatchSlots;
+
+    /** Index of the current ball carrier (INDEX_NONE if nobody has the ball) */
+    int32 CarrierIndex = INDEX_NONE;
+
+    /** Spatial index over Positions/Teams; query results are indices into the arrays above */
+    FMF_SpatialGrid Grid;
+
+    /** Match ball and its location at build time (nullptr if no ball registered) */
+    AMF_Ball *Ball = nullptr;
+    FVector BallLocation = FVector::ZeroVector;
+    FVector BallVelocity = FVector::ZeroVector;
+
+    // ==================== Ball Chase Ranking ====================
+    /** Role-weighted estimated time (seconds) for each player to reach the ball (MAX_flt if no ball) */
+    TArray<float> BallChaseTimes;
+
+    /** Each player's position in their team's chase order (0 = first to the ball) */
+    TArray<int32> BallChaseRanks;
+
+    /** Per team (indexed by EMF_TeamID), snapshot indices sorted by BallChaseTimes */
+    TArray<int32> ChaseOrder[3];
+
+    /** Chase times within this margin of the team's best count as "closest" (50cm at sprint speed) */
+    static constexpr float ChaseTieMargin = 50.0f / MF_Constants::SprintSpeed;
+
+    /** Snapshot index of the Rank-th chaser for Team (INDEX_NONE if the team has fewer players) */
+    int32 GetChaser(EMF_TeamID Team, int32 Rank) const
+    {
+        const TArray<int32> &Order = ChaseOrder[static_cast<uint8>(Team)];
+        return Order.IsValidIndex(Rank) ? Order[Rank] : INDEX_NONE;
+    }
+
+    int32 Num() const { return Characters.Num(); }
+
+    /** Snapshot index of a character (INDEX_NONE if not registered) */
+    int32 IndexOf(const AMF_PlayerCharacter *Character) const;
+
+    /** Snapshot index of the player in a match slot (INDEX_NONE if none) */
+    int32 IndexOfSlot(uint8 Slot) const
+    {
+        return IndexBySlot.IsValidIndex(Slot) ? IndexBySlot[Slot] : INDEX_NONE;
+    }
+
+    /** Clear all arrays, keeping allocations */
+    void Reset();
+
+private:
+    /** Snapshot index per match slot (flat, INDEX_NONE for empty slots) */
+    TArray<int32> IndexBySlot;
+
+    friend class UMF_PlayerSnapshotSubsystem;
+};
+
+/**
+ * UMF_PlayerSnapshotSubsystem
+ * Owns the list of live players/balls and the per-frame snapshot built from them.
+ *
+ * Characters and balls register themselves in BeginPlay and unregister in EndPlay.
+ * Possession/state setters call Invalidate() so readers later in the same frame
+ * see the change.
+ */
+UCLASS()
+class P_MINIFOOTBALL_API UMF_PlayerSnapshotSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /** Get the subsystem for a world context (nullptr if none) */
+    static UMF_PlayerSnapshotSubsystem *Get(const UObject *WorldContextObject);
+
+    // ==================== Registration ====================
+
+    /** Add a player; call again when its match slot changes */
+    void RegisterPlayer(AMF_PlayerCharacter *Character);
+    void UnregisterPlayer(AMF_PlayerCharacter *Character);
+
+    /** Registered player in a match slot (nullptr if none) */
+    AMF_PlayerCharacter *FindPlayerBySlot(uint8 Slot) const
+    {
+        return PlayersBySlot.IsValidIndex(Slot) ? PlayersBySlot[Slot].Get() : nullptr;
+    }
+
+    void RegisterBall(AMF_Ball *Ball);
+    void UnregisterBall(AMF_Ball *Ball);
+
+    // ==================== Snapshot Access ====================
+
+    /** Snapshot for the current frame (rebuilt on first access each frame) */
+    const FMF_PlayerSnapshot &GetSnapshot();
+
+    /** Force the next GetSnapshot() call to rebuild (and expire anything keyed on the generation) */
+    void Invalidate()
+    {
+        BuiltFrame = MAX_uint64;
+        ++Generation;
+    }
+
+    /** Bumped by every Invalidate(); per-frame caches derived from the snapshot compare against it */
+    uint64 GetGeneration() const { return Generation; }
+
+protected:
+    virtual void Deinitialize() override;
+
+private:
+    void RebuildSnapshot();
+
+    /** Fill BallChaseTimes/Ranks and ChaseOrder from the already-built arrays */
+    void BuildBallChaseRanking();
+
+    TArray<TWeakObjectPtr<AMF_PlayerCharacter>> RegisteredPlayers;
+
+    TArray<TWeakObjectPtr<AMF_Ball>> RegisteredBalls;
+
+    /** RegisteredPlayers by match slot */
+    TArray<TWeakObjectPtr<AMF_PlayerCharacter>> PlayersBySlot;
+
+    /** Drop a player from PlayersBySlot (before re-registering or on unregister) */
+    void ClearSlotOf(const AMF_PlayerCharacter *Character);
+
+    FMF_PlayerSnapshot Snapshot;
+
+    /** GFrameCounter value the snapshot was built for */
+    uint64 BuiltFrame = MAX_uint64;
+
+    uint64 Generation = 0;
+};
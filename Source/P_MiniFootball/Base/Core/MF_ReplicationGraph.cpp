@@ -0,0 +1,107 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: MF_ReplicationGraph - Implementation
+ * @Date: 16/10/2026
+ */
+
+#include "Core/MF_ReplicationGraph.h"
+#include "Core/MF_PlayerSnapshotSubsystem.h"
+#include "Player/MF_PlayerCharacter.h"
+#include "Settings/MF_NetworkSettings.h"
+#include "Engine/NetConnection.h"
+#include "Engine/NetDriver.h"
+
+// ==================== UMF_ReplicationGraphNode_Players ====================
+
+void UMF_ReplicationGraphNode_Players::NotifyAddNetworkActor(const FNewReplicatedActorInfo &ActorInfo)
+{
+    Players.Add(ActorInfo.Actor);
+}
+
+bool UMF_ReplicationGraphNode_Players::NotifyRemoveNetworkActor(const FNewReplicatedActorInfo &ActorInfo, bool bWarnIfNotFound)
+{
+    return Players.RemoveFast(ActorInfo.Actor);
+}
+
+void UMF_ReplicationGraphNode_Players::NotifyResetAllNetworkActors()
+{
+    Players.Reset();
+}
+
+void UMF_ReplicationGraphNode_Players::GatherActorListsForConnection(const FConnectionGatherActorListParameters &Params)
+{
+    if (Players.Num() == 0)
+    {
+        return;
+    }
+
+    const UMF_NetworkSettings *Settings = UMF_NetworkSettings::Get();
+    const UNetConnection *Connection = Params.ConnectionManager.NetConnection;
+    const float ServerTickRate = Connection && Connection->Driver ? static_cast<float>(Connection->Driver->GetNetServerMaxTickRate()) : 30.0f;
+
+    const AActor *Ball = nullptr;
+    FVector BallLocation = FVector::ZeroVector;
+    if (UMF_PlayerSnapshotSubsystem *Snapshots = GraphGlobals.IsValid() ? UMF_PlayerSnapshotSubsystem::Get(GraphGlobals->World) : nullptr)
+    {
+        const FMF_PlayerSnapshot &Snapshot = Snapshots->GetSnapshot();
+        Ball = Snapshot.Ball;
+        BallLocation = Snapshot.BallLocation;
+    }
+
+    for (FActorRepListType Actor : Players)
+    {
+        const FVector Location = Actor->GetActorLocation();
+        const AController *Controller = CastChecked<AMF_PlayerCharacter>(Actor)->GetController();
+
+        // Nearest of this connection's viewers (split screen); the viewer's own character is never slowed down
+        float Distance = Ball ? FVector::Dist2D(Location, BallLocation) : MAX_flt;
+        for (const FNetViewer &Viewer : Params.Viewers)
+        {
+            if (Viewer.ViewTarget == Actor || (Controller && Viewer.InViewer == Controller))
+            {
+                Distance = 0.0f;
+                break;
+            }
+            const FVector Focus = Viewer.ViewTarget ? Viewer.ViewTarget->GetActorLocation() : Viewer.ViewLocation;
+            Distance = FMath::Min(Distance, FVector::Dist2D(Location, Focus));
+        }
+
+        FConnectionReplicationActorInfo &ActorInfo = Params.ConnectionManager.ActorInfoMap.FindOrAdd(Actor);
+        ActorInfo.ReplicationPeriodFrame = Settings->GetReplicationPeriodFrames(Actor->GetNetUpdateFrequency(), Distance, ServerTickRate);
+
+        // Coming closer takes effect now rather than after the send scheduled at the old, slower period
+        ActorInfo.NextReplicationFrameNum = FMath::Min(ActorInfo.NextReplicationFrameNum, ActorInfo.LastRepFrameNum + ActorInfo.ReplicationPeriodFrame);
+    }
+
+    Params.OutGatheredReplicationLists.AddReplicationActorList(Players);
+}
+
+// ==================== UMF_ReplicationGraph ====================
+
+void UMF_ReplicationGraph::InitGlobalGraphNodes()
+{
+    Super::InitGlobalGraphNodes();
+
+    PlayersNode = CreateNewNode<UMF_ReplicationGraphNode_Players>();
+    AddGlobalGraphNode(PlayersNode);
+}
+
+void UMF_ReplicationGraph::RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo &ActorInfo, FGlobalActorReplicationInfo &GlobalInfo)
+{
+    if (ActorInfo.Actor->IsA<AMF_PlayerCharacter>())
+    {
+        PlayersNode->NotifyAddNetworkActor(ActorInfo);
+        return;
+    }
+    Super::RouteAddNetworkActorToNodes(ActorInfo, GlobalInfo);
+}
+
+void UMF_ReplicationGraph::RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo &ActorInfo)
+{
+    if (ActorInfo.Actor->IsA<AMF_PlayerCharacter>())
+    {
+        PlayersNode->NotifyRemoveNetworkActor(ActorInfo);
+        return;
+    }
+    Super::RouteRemoveNetworkActorToNodes(ActorInfo);
+}
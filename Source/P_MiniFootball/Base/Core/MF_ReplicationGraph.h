@@ -0,0 +1,58 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: MF_ReplicationGraph - Replication graph with per-connection, distance-based update rates for characters
+ * @Date: 16/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ReplicationGraph.h"
+#include "BasicReplicationGraph.h"
+#include "MF_ReplicationGraph.generated.h"
+
+/**
+ * UMF_ReplicationGraphNode_Players
+ * Holds every AMF_PlayerCharacter. For each connection it sets how many frames pass between sends of each
+ * character, from that character's current NetUpdateFrequency (activity tier) and its 2D distance to the
+ * connection's view target or the ball, whichever is nearer (UMF_NetworkSettings::GetReplicationPeriodFrames).
+ * The graph then skips a character for that connection until its period has elapsed.
+ */
+UCLASS()
+class P_MINIFOOTBALL_API UMF_ReplicationGraphNode_Players : public UReplicationGraphNode
+{
+    GENERATED_BODY()
+
+public:
+    virtual void NotifyAddNetworkActor(const FNewReplicatedActorInfo &ActorInfo) override;
+    virtual bool NotifyRemoveNetworkActor(const FNewReplicatedActorInfo &ActorInfo, bool bWarnIfNotFound = true) override;
+    virtual void NotifyResetAllNetworkActors() override;
+    virtual void GatherActorListsForConnection(const FConnectionGatherActorListParameters &Params) override;
+
+private:
+    FActorRepListRefView Players;
+};
+
+/**
+ * UMF_ReplicationGraph
+ * UBasicReplicationGraph with characters routed to UMF_ReplicationGraphNode_Players instead of the spatial grid.
+ * Always-relevant actors (ball, game state, drill ball manager) and owner-only actors keep the basic routing.
+ *
+ * Enable in the project's DefaultEngine.ini:
+ *   [/Script/OnlineSubsystemUtils.IpNetDriver]
+ *   ReplicationDriverClassName="/Script/P_MiniFootball.MF_ReplicationGraph"
+ */
+UCLASS(Transient, Config = Engine)
+class P_MINIFOOTBALL_API UMF_ReplicationGraph : public UBasicReplicationGraph
+{
+    GENERATED_BODY()
+
+public:
+    virtual void InitGlobalGraphNodes() override;
+    virtual void RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo &ActorInfo, FGlobalActorReplicationInfo &GlobalInfo) override;
+    virtual void RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo &ActorInfo) override;
+
+private:
+    UPROPERTY()
+    TObjectPtr<UMF_ReplicationGraphNode_Players> PlayersNode;
+};
@@ -0,0 +1,189 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: MF_SpatialGrid - Implementation
+ * @Date: 16/10/2026
+ */
+
+#include "Core/MF_SpatialGrid.h"
+
+void FMF_SpatialGrid::Initialize(const FVector2D &InMin, const FVector2D &InMax, float InCellSize)
+{
+    CellSize = FMath::Max(InCellSize, 1.0f);
+    InvCellSize = 1.0 / CellSize;
+    Min = InMin;
+
+    const FVector2D Size = (InMax - InMin).ComponentMax(FVector2D(CellSize, CellSize));
+    CellsX = FMath::Max(1, FMath::CeilToInt32(Size.X * InvCellSize));
+    CellsY = FMath::Max(1, FMath::CeilToInt32(Size.Y * InvCellSize));
+
+    CellStart.SetNumZeroed(CellsX * CellsY + 1);
+    Reset();
+}
+
+void FMF_SpatialGrid::InitializeForField(float Margin)
+{
+    // Field width runs along X, length along Y
+    const FVector2D HalfExtent(MF_Constants::FieldWidth / 2.0f + Margin, MF_Constants::FieldLength / 2.0f + Margin);
+    Initialize(-HalfExtent, HalfExtent, DefaultCellSize);
+}
+
+void FMF_SpatialGrid::Reset()
+{
+    Positions.Reset();
+    Teams.Reset();
+    CellItems.Reset();
+    FMemory::Memzero(CellStart.GetData(), CellStart.Num() * sizeof(int32));
+}
+
+void FMF_SpatialGrid::Build(TConstArrayView<FVector> InPositions, TConstArrayView<EMF_TeamID> InTeams)
+{
+    check(InPositions.Num() == InTeams.Num());
+
+    if (CellsX == 0)
+    {
+        InitializeForField();
+    }
+
+    Reset();
+    Positions.Append(InPositions.GetData(), InPositions.Num());
+    Teams.Append(InTeams.GetData(), InTeams.Num());
+
+    const int32 Count = Positions.Num();
+    const int32 NumCells = CellsX * CellsY;
+
+    // Counting sort: count per cell, prefix sum into starts, then scatter
+    TArray<int32, TInlineAllocator<64>> ItemCell;
+    ItemCell.SetNumUninitialized(Count);
+    for (int32 Index = 0; Index < Count; ++Index)
+    {
+        const int32 Cell = CellCoordY(Positions[Index].Y) * CellsX + CellCoordX(Positions[Index].X);
+        ItemCell[Index] = Cell;
+        ++CellStart[Cell + 1];
+    }
+
+    for (int32 Cell = 0; Cell < NumCells; ++Cell)
+    {
+        CellStart[Cell + 1] += CellStart[Cell];
+    }
+
+    TArray<int32, TInlineAllocator<256>> Cursor;
+    Cursor.Append(CellStart.GetData(), NumCells);
+
+    CellItems.SetNumUninitialized(Count);
+    for (int32 Index = 0; Index < Count; ++Index)
+    {
+        CellItems[Cursor[ItemCell[Index]]++] = Index;
+    }
+}
+
+// ==================== Queries ====================
+
+void FMF_SpatialGrid::QueryRadius(const FVector &Center, float Radius, uint8 TeamMask, TArray<int32> &OutIndices,
+                                  int32 ExcludeIndex) const
+{
+    OutIndices.Reset();
+    if (Positions.Num() == 0 || Radius < 0.0f)
+    {
+        return;
+    }
+
+    const int32 MinX = CellCoordX(Center.X - Radius);
+    const int32 MaxX = CellCoordX(Center.X + Radius);
+    const int32 MinY = CellCoordY(Center.Y - Radius);
+    const int32 MaxY = CellCoordY(Center.Y + Radius);
+    const double RadiusSq = FMath::Square(static_cast<double>(Radius));
+
+    for (int32 Y = MinY; Y <= MaxY; ++Y)
+    {
+        for (int32 X = MinX; X <= MaxX; ++X)
+        {
+            const int32 Cell = Y * CellsX + X;
+            for (int32 Slot = CellStart[Cell]; Slot < CellStart[Cell + 1]; ++Slot)
+            {
+                const int32 Index = CellItems[Slot];
+                if (Index != ExcludeIndex && PassesMask(Teams[Index], TeamMask) &&
+                    FVector::DistSquared(Center, Positions[Index]) <= RadiusSq)
+                {
+                    OutIndices.Add(Index);
+                }
+            }
+        }
+    }
+}
+
+int32 FMF_SpatialGrid::FindNearest(const FVector &Position, uint8 TeamMask, int32 ExcludeIndex,
+                                   float MaxRadius, float *OutDistance) const
+{
+    int32 BestIndex = INDEX_NONE;
+    double BestDistSq = FMath::Square(static_cast<double>(MaxRadius));
+
+    if (Positions.Num() > 0)
+    {
+        const int32 CX = CellCoordX(Position.X);
+        const int32 CY = CellCoordY(Position.Y);
+        const int32 MaxRing = FMath::Max(CellsX, CellsY);
+
+        auto ScanCell = [&](int32 X, int32 Y)
+        {
+            const int32 Cell = Y * CellsX + X;
+            for (int32 Slot = CellStart[Cell]; Slot < CellStart[Cell + 1]; ++Slot)
+            {
+                const int32 Index = CellItems[Slot];
+                if (Index == ExcludeIndex || !PassesMask(Teams[Index], TeamMask))
+                {
+                    continue;
+                }
+
+                const double DistSq = FVector::DistSquared(Position, Positions[Index]);
+                if (DistSq < BestDistSq)
+                {
+                    BestDistSq = DistSq;
+                    BestIndex = Index;
+                }
+            }
+        };
+
+        for (int32 Ring = 0; Ring <= MaxRing; ++Ring)
+        {
+            // Anything in this ring is at least (Ring - 1) cells away from Position
+            if (Ring > 1 && FMath::Square(static_cast<double>(Ring - 1) * CellSize) > BestDistSq)
+            {
+                break;
+            }
+
+            const int32 MinY = FMath::Max(CY - Ring, 0);
+            const int32 MaxY = FMath::Min(CY + Ring, CellsY - 1);
+            const int32 MinX = FMath::Max(CX - Ring, 0);
+            const int32 MaxX = FMath::Min(CX + Ring, CellsX - 1);
+
+            for (int32 Y = MinY; Y <= MaxY; ++Y)
+            {
+                const bool bEdgeRow = (Y == CY - Ring) || (Y == CY + Ring);
+                if (bEdgeRow)
+                {
+                    for (int32 X = MinX; X <= MaxX; ++X)
+                    {
+                        ScanCell(X, Y);
+                    }
+                }
+                else
+                {
+                    if (CX - Ring >= 0)
+                    {
+                        ScanCell(CX - Ring, Y);
+                    }
+                    if (Ring > 0 && CX + Ring < CellsX)
+                    {
+                        ScanCell(CX + Ring, Y);
+                    }
+                }
+            }
+        }
+    }
+
+    if (OutDistance)
+    {
+        *OutDistance = (BestIndex != INDEX_NONE) ? static_cast<float>(FMath::Sqrt(BestDistSq)) : MaxRadius;
+    }
+    return BestIndex;
+}
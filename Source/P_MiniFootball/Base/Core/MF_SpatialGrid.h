@@ -0,0 +1,94 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: MF_SpatialGrid - Uniform bucket grid over the pitch for radius / nearest queries
+ *               Rebuilt from the player snapshot each frame; results are snapshot indices
+ * @Date: 16/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/MF_Types.h"
+
+/**
+ * Team filters for grid queries.
+ * A mask has one bit per EMF_TeamID value.
+ */
+namespace MF_TeamMask
+{
+    constexpr uint8 All = 0xFF;
+
+    /** Only players of Team */
+    constexpr uint8 Only(EMF_TeamID Team) { return static_cast<uint8>(1u << static_cast<uint8>(Team)); }
+
+    /** Everyone except players of Team */
+    constexpr uint8 AllExcept(EMF_TeamID Team) { return static_cast<uint8>(All & ~Only(Team)); }
+}
+
+/**
+ * FMF_SpatialGrid
+ * Fixed-bounds uniform grid on the XY plane storing item indices in cell order
+ * (counting sort into one flat array, no per-cell allocations).
+ *
+ * Positions outside the bounds are clamped into the edge cells, so queries stay
+ * exact for players/balls that leave the pitch. Distance tests use full 3D distance
+ * to match FVector::Dist callers.
+ */
+struct P_MINIFOOTBALL_API FMF_SpatialGrid
+{
+    /** Default cell size (cm) - larger than tackle/pickup/separation radii so most queries touch <= 4 cells */
+    static constexpr float DefaultCellSize = 500.0f;
+
+    /** Set bounds and cell size. Cheap; only reallocates when the cell count changes. */
+    void Initialize(const FVector2D &InMin, const FVector2D &InMax, float InCellSize = DefaultCellSize);
+
+    /** Initialize over the pitch (MF_Constants field size) plus a margin for out-of-play positions */
+    void InitializeForField(float Margin = DefaultCellSize);
+
+    /** Bucket all items. Positions and Teams must be index-aligned. */
+    void Build(TConstArrayView<FVector> InPositions, TConstArrayView<EMF_TeamID> InTeams);
+
+    /** Remove all items (keeps bounds and allocations) */
+    void Reset();
+
+    /**
+     * Collect indices of items within Radius of Center whose team is in TeamMask.
+     * OutIndices is reset first. Order is unspecified.
+     */
+    void QueryRadius(const FVector &Center, float Radius, uint8 TeamMask, TArray<int32> &OutIndices,
+                     int32 ExcludeIndex = INDEX_NONE) const;
+
+    /**
+     * Index of the nearest item whose team is in TeamMask and which lies within MaxRadius,
+     * or INDEX_NONE. Searches rings of cells outward and stops once no closer item is possible.
+     */
+    int32 FindNearest(const FVector &Position, uint8 TeamMask, int32 ExcludeIndex = INDEX_NONE,
+                      float MaxRadius = TNumericLimits<float>::Max(), float *OutDistance = nullptr) const;
+
+    int32 Num() const { return Positions.Num(); }
+    int32 GetCellCountX() const { return CellsX; }
+    int32 GetCellCountY() const { return CellsY; }
+
+private:
+    int32 CellCoordX(double X) const { return FMath::FloorToInt32(FMath::Clamp((X - Min.X) * InvCellSize, 0.0, static_cast<double>(CellsX - 1))); }
+    int32 CellCoordY(double Y) const { return FMath::FloorToInt32(FMath::Clamp((Y - Min.Y) * InvCellSize, 0.0, static_cast<double>(CellsY - 1))); }
+
+    static bool PassesMask(EMF_TeamID Team, uint8 TeamMask)
+    {
+        return (TeamMask & MF_TeamMask::Only(Team)) != 0;
+    }
+
+    FVector2D Min = FVector2D::ZeroVector;
+    float CellSize = DefaultCellSize;
+    double InvCellSize = 1.0 / DefaultCellSize;
+    int32 CellsX = 0;
+    int32 CellsY = 0;
+
+    /** CellStart[c]..CellStart[c+1] is the range of CellItems belonging to cell c */
+    TArray<int32> CellStart;
+    TArray<int32> CellItems;
+
+    /** Copies of the built data so queries do not depend on caller lifetime */
+    TArray<FVector> Positions;
+    TArray<EMF_TeamID> Teams;
+};
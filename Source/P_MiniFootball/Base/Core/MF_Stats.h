@@ -0,0 +1,29 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: MF_Stats - Stat group and counters for P_MiniFootball runtime systems
+ *               View in-game with "stat MiniFootball"
+ * @Date: 16/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+
+DECLARE_STATS_GROUP(TEXT("MiniFootball"), STATGROUP_MiniFootball, STATCAT_Advanced);
+
+// ==================== Target Cache ====================
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Target Cache Hits"), STAT_MF_TargetCacheHits, STATGROUP_MiniFootball, P_MINIFOOTBALL_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Target Cache Misses"), STAT_MF_TargetCacheMisses, STATGROUP_MiniFootball, P_MINIFOOTBALL_API);
+
+// ==================== Blackboard Writer ====================
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Blackboard Writes"), STAT_MF_BlackboardWrites, STATGROUP_MiniFootball, P_MINIFOOTBALL_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Blackboard Writes Skipped"), STAT_MF_BlackboardWritesSkipped, STATGROUP_MiniFootball, P_MINIFOOTBALL_API);
+
+// ==================== AI Sync Scheduler ====================
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("AI Agents Synced"), STAT_MF_AISyncAgents, STATGROUP_MiniFootball, P_MINIFOOTBALL_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("AI Agents Deferred (Budget)"), STAT_MF_AISyncDeferred, STATGROUP_MiniFootball, P_MINIFOOTBALL_API);
+
+// ==================== Ball ====================
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Ball Transform Commits"), STAT_MF_BallTransformCommits, STATGROUP_MiniFootball, P_MINIFOOTBALL_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Drill Ball Steps"), STAT_MF_DrillBallSteps, STATGROUP_MiniFootball, P_MINIFOOTBALL_API);
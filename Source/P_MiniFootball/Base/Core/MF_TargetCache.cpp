@@ -0,0 +1,107 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: MF_TargetCache - Implementation
+ * @Date: 16/10/2026
+ */
+
+#include "Core/MF_TargetCache.h"
+#include "Core/MF_Stats.h"
+#include "GameFramework/Actor.h"
+#include "HAL/IConsoleManager.h"
+
+DEFINE_STAT(STAT_MF_TargetCacheHits);
+DEFINE_STAT(STAT_MF_TargetCacheMisses);
+
+uint64 FMF_TargetCache::TotalHits = 0;
+uint64 FMF_TargetCache::TotalMisses = 0;
+
+namespace
+{
+    void LogTargetCacheStats(const TArray<FString> &Args)
+    {
+        const uint64 Hits = FMF_TargetCache::GetTotalHits();
+        const uint64 Misses = FMF_TargetCache::GetTotalMisses();
+        const uint64 Total = Hits + Misses;
+        const double HitRate = Total > 0 ? (100.0 * Hits) / Total : 0.0;
+
+        UE_LOG(LogTemp, Log, TEXT("MF_TargetCache - Hits: %llu, Misses: %llu, HitRate: %.1f%%"), Hits, Misses, HitRate);
+
+        if (Args.Num() > 0 && Args[0].Equals(TEXT("reset"), ESearchCase::IgnoreCase))
+        {
+            FMF_TargetCache::ResetCounters();
+        }
+    }
+
+    static FAutoConsoleCommand CCmdTargetCacheStats(
+        TEXT("MF.TargetCache.Stats"),
+        TEXT("Log P_MiniFootball AI target cache hit/miss totals. Pass 'reset' to clear them afterwards."),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&LogTargetCacheStats));
+}
+
+// ==================== Target IDs ====================
+
+EMF_TargetID MF_Targets::FromName(FName TargetName)
+{
+    static const TMap<FName, EMF_TargetID> Interned = {
+        {FName(TEXT("Ball")), EMF_TargetID::Ball},
+        {FName(TEXT("Goal_Opponent")), EMF_TargetID::Goal_Opponent},
+        {FName(TEXT("Goal_Self")), EMF_TargetID::Goal_Self},
+        {FName(TEXT("BallCarrier")), EMF_TargetID::BallCarrier},
+        {FName(TEXT("NearestOpponent")), EMF_TargetID::NearestOpponent},
+        {FName(TEXT("Striker")), EMF_TargetID::Striker},
+        {FName(TEXT("Midfielder")), EMF_TargetID::Midfielder},
+    };
+
+    const EMF_TargetID *Found = Interned.Find(TargetName);
+    return Found ? *Found : EMF_TargetID::Unknown;
+}
+
+// ==================== Cache ====================
+
+bool FMF_TargetCache::Lookup(EMF_TargetID Id, uint64 Generation, AActor *&OutActor, bool &bOutFound) const
+{
+    const FEntry &Entry = Entries[static_cast<int32>(Id)];
+
+    // A found actor destroyed since it was stored counts as a miss
+    const bool bHit = Entry.Frame == GFrameCounter && Entry.Generation == Generation &&
+                      (!Entry.bFound || Entry.Actor.IsValid());
+    if (!bHit)
+    {
+        ++TotalMisses;
+        INC_DWORD_STAT(STAT_MF_TargetCacheMisses);
+        return false;
+    }
+
+    ++TotalHits;
+    INC_DWORD_STAT(STAT_MF_TargetCacheHits);
+
+    bOutFound = Entry.bFound;
+    if (Entry.bFound)
+    {
+        OutActor = Entry.Actor.Get();
+    }
+    return true;
+}
+
+void FMF_TargetCache::Store(EMF_TargetID Id, uint64 Generation, AActor *Actor, bool bFound)
+{
+    FEntry &Entry = Entries[static_cast<int32>(Id)];
+    Entry.Actor = Actor;
+    Entry.Frame = GFrameCounter;
+    Entry.Generation = Generation;
+    Entry.bFound = bFound;
+}
+
+void FMF_TargetCache::Invalidate()
+{
+    for (FEntry &Entry : Entries)
+    {
+        Entry = FEntry();
+    }
+}
+
+void FMF_TargetCache::ResetCounters()
+{
+    TotalHits = 0;
+    TotalMisses = 0;
+}
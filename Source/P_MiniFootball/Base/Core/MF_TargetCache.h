@@ -0,0 +1,75 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: MF_TargetCache - Per-character resolved EAIS target table
+ *               Target names are interned once to EMF_TargetID; resolved actors are
+ *               reused for the rest of the frame unless the player snapshot is invalidated
+ * @Date: 16/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class AActor;
+
+/**
+ * Actor targets resolved natively by AMF_PlayerCharacter.
+ * Matches the names used in AI profile JSON ("Ball", "Goal_Opponent", ...).
+ */
+enum class EMF_TargetID : uint8
+{
+    Ball,
+    Goal_Opponent,
+    Goal_Self,
+    BallCarrier,
+    NearestOpponent,
+    Striker,
+    Midfielder,
+
+    Count,
+    Unknown = 0xFF
+};
+
+namespace MF_Targets
+{
+    /** Intern a target name (O(1) hash lookup). Returns Unknown for non-actor targets. */
+    P_MINIFOOTBALL_API EMF_TargetID FromName(FName TargetName);
+}
+
+/**
+ * FMF_TargetCache
+ * Fixed-size table indexed by EMF_TargetID. An entry is valid for the frame and
+ * snapshot generation it was stored in (see UMF_PlayerSnapshotSubsystem::GetGeneration).
+ */
+struct P_MINIFOOTBALL_API FMF_TargetCache
+{
+    /** Returns true on a hit and fills OutActor / bOutFound with the cached result */
+    bool Lookup(EMF_TargetID Id, uint64 Generation, AActor *&OutActor, bool &bOutFound) const;
+
+    /** Store a resolved result (including "not found") for the current frame */
+    void Store(EMF_TargetID Id, uint64 Generation, AActor *Actor, bool bFound);
+
+    /** Drop every entry */
+    void Invalidate();
+
+    // ==================== Counters ====================
+
+    /** Totals across all caches since start / last reset (game thread only) */
+    static uint64 GetTotalHits() { return TotalHits; }
+    static uint64 GetTotalMisses() { return TotalMisses; }
+    static void ResetCounters();
+
+private:
+    struct FEntry
+    {
+        TWeakObjectPtr<AActor> Actor;
+        uint64 Frame = MAX_uint64;
+        uint64 Generation = MAX_uint64;
+        bool bFound = false;
+    };
+
+    FEntry Entries[static_cast<int32>(EMF_TargetID::Count)];
+
+    static uint64 TotalHits;
+    static uint64 TotalMisses;
+};
@@ -0,0 +1,140 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: MF_Types - Implementation (replication struct serializers)
+ * @Date: 16/10/2026
+ */
+
+#include "Core/MF_Types.h"
+
+namespace
+{
+    /** Pitch plus nets / run-off on XY; ground to well above the highest lofted ball on Z (cm) */
+    constexpr float PositionMargin = 1000.0f;
+    const FVector PositionMin(-MF_Constants::FieldWidth / 2.0f - PositionMargin,
+                              -MF_Constants::FieldLength / 2.0f - PositionMargin,
+                              MF_Constants::GroundZ - 100.0f);
+    const FVector PositionMax(MF_Constants::FieldWidth / 2.0f + PositionMargin,
+                              MF_Constants::FieldLength / 2.0f + PositionMargin,
+                              MF_Constants::GroundZ + 6000.0f);
+
+    constexpr float QuantizedMax = 65535.0f;
+
+    enum EBallDataFlags : uint8
+    {
+        StateMask = 0x03,
+        Grounded = 1 << 2,
+        RawLocation = 1 << 3,
+        HasPossessor = 1 << 4,
+    };
+
+    void SerializeRange(FArchive &Ar, double &Value, float Min, float Max)
+    {
+        uint16 Quantized = 0;
+        if (Ar.IsSaving())
+        {
+            const float Alpha = FMath::Clamp((static_cast<float>(Value) - Min) / (Max - Min), 0.0f, 1.0f);
+            Quantized = static_cast<uint16>(FMath::RoundToInt32(Alpha * QuantizedMax));
+        }
+        Ar << Quantized;
+        if (Ar.IsLoading())
+        {
+            Value = Min + (Max - Min) * (Quantized / QuantizedMax);
+        }
+    }
+
+    /** Symmetric signed quantization, so zero (a ball at rest) round-trips exactly */
+    void SerializeSigned(FArchive &Ar, double &Value, float Max)
+    {
+        int16 Quantized = 0;
+        if (Ar.IsSaving())
+        {
+            Quantized = static_cast<int16>(FMath::RoundToInt32(FMath::Clamp(static_cast<float>(Value) / Max, -1.0f, 1.0f) * MAX_int16));
+        }
+        Ar << Quantized;
+        if (Ar.IsLoading())
+        {
+            Value = Max * (static_cast<float>(Quantized) / MAX_int16);
+        }
+    }
+
+    bool IsOnQuantizedPitch(const FVector &Location)
+    {
+        return Location.X >= PositionMin.X && Location.X <= PositionMax.X &&
+               Location.Y >= PositionMin.Y && Location.Y <= PositionMax.Y &&
+               Location.Z >= PositionMin.Z && Location.Z <= PositionMax.Z;
+    }
+}
+
+// ==================== FMF_BallReplicationData ====================
+
+float FMF_BallReplicationData::UnwrapTimestamp(float WrappedTimestamp, float ServerNow)
+{
+    float Timestamp = ServerNow - FMath::Fmod(ServerNow, TimestampPeriod) + WrappedTimestamp;
+    if (Timestamp - ServerNow > TimestampPeriod / 2.0f)
+    {
+        Timestamp -= TimestampPeriod;
+    }
+    else if (ServerNow - Timestamp > TimestampPeriod / 2.0f)
+    {
+        Timestamp += TimestampPeriod;
+    }
+    return Timestamp;
+}
+
+bool FMF_BallReplicationData::NetSerialize(FArchive &Ar, UPackageMap *Map, bool &bOutSuccess)
+{
+    // State (2 bits) + flags
+    uint8 Flags = 0;
+    if (Ar.IsSaving())
+    {
+        Flags = static_cast<uint8>(State) & StateMask;
+        Flags |= bIsGrounded ? Grounded : 0;
+        Flags |= IsOnQuantizedPitch(Location) ? 0 : RawLocation;
+        Flags |= PossessorSlot != MF_Constants::InvalidMatchSlot ? HasPossessor : 0;
+    }
+    Ar << Flags;
+
+    if (Ar.IsLoading())
+    {
+        State = static_cast<EMF_BallState>(Flags & StateMask);
+        bIsGrounded = (Flags & Grounded) != 0;
+        PossessorSlot = MF_Constants::InvalidMatchSlot;
+    }
+
+    // Location: 16-bit fixed point over the pitch bounds, raw off it
+    if (Flags & RawLocation)
+    {
+        Ar << Location;
+    }
+    else
+    {
+        SerializeRange(Ar, Location.X, PositionMin.X, PositionMax.X);
+        SerializeRange(Ar, Location.Y, PositionMin.Y, PositionMax.Y);
+        SerializeRange(Ar, Location.Z, PositionMin.Z, PositionMax.Z);
+    }
+
+    // Velocity: 16 bits per axis over +/-BallMaxSpeed
+    SerializeSigned(Ar, Velocity.X, MF_Constants::BallMaxSpeed);
+    SerializeSigned(Ar, Velocity.Y, MF_Constants::BallMaxSpeed);
+    SerializeSigned(Ar, Velocity.Z, MF_Constants::BallMaxSpeed);
+
+    if (Flags & HasPossessor)
+    {
+        Ar << PossessorSlot;
+    }
+
+    // Milliseconds, wrapping; the receiver unwraps against its own estimate of server time
+    uint16 TimestampMs = 0;
+    if (Ar.IsSaving())
+    {
+        TimestampMs = static_cast<uint16>(static_cast<uint64>(FMath::Max(0.0, FMath::RoundToDouble(ServerTimestamp * 1000.0))) & 0xFFFF);
+    }
+    Ar << TimestampMs;
+    if (Ar.IsLoading())
+    {
+        ServerTimestamp = TimestampMs / 1000.0f;
+    }
+
+    bOutSuccess = !Ar.IsError();
+    return true;
+}
@@ -13,6 +13,7 @@
 // Forward declarations
 class APlayerController;
 class AMF_PlayerCharacter;
+class UPackageMap;
 
 // ==================== Team Identification ====================
 
@@ -77,6 +78,28 @@ enum class EMF_BallState : uint8
     OutOfBounds UMETA(DisplayName = "Out Of Bounds") // Ball left the field
 };
 
+/** Which boundary the whole ball crossed during a physics step */
+UENUM(BlueprintType)
+enum class EMF_BallCrossing : uint8
+{
+    None UMETA(DisplayName = "None"),
+    Goal UMETA(DisplayName = "Goal"),             // Over the goal line between the posts, under the bar
+    GoalLine UMETA(DisplayName = "Goal Line"),    // Over the goal line outside the goal mouth
+    Touchline UMETA(DisplayName = "Touchline")    // Hit a touchline (side boards; the ball rebounds)
+};
+
+// ==================== Net Activity ====================
+
+/** How busy a replicated actor is right now; picks its update-rate tier (see UMF_NetworkSettings). Ordered quietest to busiest. */
+UENUM(BlueprintType)
+enum class EMF_NetActivity : uint8
+{
+    None UMETA(DisplayName = "None"),     // Not classified yet
+    Idle UMETA(DisplayName = "Idle"),     // Standing still or stunned / ball at rest
+    Active UMETA(DisplayName = "Active"), // Moving, away from the ball / ball rolling loose
+    Hot UMETA(DisplayName = "Hot")        // Carrier or near the ball / ball possessed or in flight
+};
+
 // ==================== Input Action Names ====================
 
 namespace MF_InputActions
@@ -122,6 +145,7 @@ namespace MF_Constants
     constexpr float BallPickupRadius = 150.0f;    // cm - auto pickup range (increased for easier pickup)
     constexpr float BallAirResistance = 50.0f;    // cm/s^2 deceleration in air
     constexpr float BallBounciness = 0.6f;        // Velocity retained on ground bounce
+    constexpr float BallMaxSpeed = BallShootSpeed * 1.3f; // Per-axis bound: full-power shot plus its 30% loft
 
     // Physics Constants
     constexpr float Gravity = 980.0f;               // cm/s^2 (9.8 m/s^2)
@@ -137,6 +161,7 @@ namespace MF_Constants
     constexpr float KickoffCountdown = 3.0f;    // 3 seconds countdown
     constexpr float GoalCelebrationTime = 2.0f; // 2 seconds after goal
     constexpr int32 MaxPlayersPerTeam = 11;     // 11v11
+    constexpr uint8 InvalidMatchSlot = 0xFF;    // Match slot of a character the game mode did not spawn
 
     // Tackling
     constexpr float TackleCooldown = 1.0f;     // seconds
@@ -176,8 +201,14 @@ struct FMF_ReplicatedMovement
 
 // ==================== Ball Replication Struct ====================
 
+/**
+ * Ball state as clients receive it. NetSerialize packs it to 15 bytes: pitch-bounded 16-bit
+ * fixed-point position (< 0.2cm steps, raw fallback off the pitch), velocity quantized to
+ * +/-BallMaxSpeed, a millisecond timestamp that wraps every 65.5s (see UnwrapTimestamp) and
+ * one state/flags byte, plus a possessor byte only while possessed.
+ */
 USTRUCT(BlueprintType)
-struct FMF_BallReplicationData
+struct P_MINIFOOTBALL_API FMF_BallReplicationData
 {
     GENERATED_BODY()
 
@@ -190,11 +221,64 @@ struct FMF_BallReplicationData
     UPROPERTY(BlueprintReadWrite)
     EMF_BallState State = EMF_BallState::Loose;
 
+    /** Match slot of the possessing character (MF_Constants::InvalidMatchSlot = no one) */
     UPROPERTY(BlueprintReadWrite)
-    uint8 PossessingPlayerID = 0; // 0 = no one
+    uint8 PossessorSlot = MF_Constants::InvalidMatchSlot;
 
+    /** Server world time of Location/Velocity; clients extrapolate from here */
     UPROPERTY(BlueprintReadWrite)
     float ServerTimestamp = 0.0f;
+
+    UPROPERTY(BlueprintReadWrite)
+    bool bIsGrounded = true;
+
+    /** Wrap period of the serialized timestamp (seconds) */
+    static constexpr float TimestampPeriod = 65.536f;
+
+    /** Received ServerTimestamp (wrapped to TimestampPeriod) back to full server time, nearest ServerNow */
+    static float UnwrapTimestamp(float WrappedTimestamp, float ServerNow);
+
+    bool NetSerialize(FArchive &Ar, UPackageMap *Map, bool &bOutSuccess);
+};
+
+template <>
+struct TStructOpsTypeTraits<FMF_BallReplicationData> : public TStructOpsTypeTraitsBase2<FMF_BallReplicationData>
+{
+    enum
+    {
+        WithNetSerializer = true
+    };
+};
+
+// ==================== Ball Boundary Crossing ====================
+
+/**
+ * First boundary the ball crossed during one physics step, from a swept test of the
+ * step's segment (never missed at high speed, never reported twice).
+ */
+USTRUCT(BlueprintType)
+struct FMF_BallCrossing
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Ball")
+    EMF_BallCrossing Type = EMF_BallCrossing::None;
+
+    /** Team whose goal line (or goal) was crossed; None for touchlines */
+    UPROPERTY(BlueprintReadOnly, Category = "Ball")
+    EMF_TeamID LineTeam = EMF_TeamID::None;
+
+    /** Ball centre at the crossing */
+    UPROPERTY(BlueprintReadOnly, Category = "Ball")
+    FVector Point = FVector::ZeroVector;
+
+    /** Position of the crossing along the step, 0 = step start, 1 = step end */
+    UPROPERTY(BlueprintReadOnly, Category = "Ball")
+    float Fraction = 0.0f;
+
+    /** World time (seconds) of the crossing */
+    UPROPERTY(BlueprintReadOnly, Category = "Ball")
+    float Time = 0.0f;
 };
 
 // ==================== Team Assignment Structs ====================
@@ -9,6 +9,7 @@
 #include "Core/MF_Types.h"
 #include "Match/MF_Goal.h"
 #include "Match/MF_PenaltyArea.h"
+#include "Match/MF_FieldLandmarks.h"
 #include "NavMesh/NavMeshBoundsVolume.h"
 #include "Kismet/GameplayStatics.h"
 #include "Components/BrushComponent.h"
@@ -55,6 +56,12 @@ void AMF_Field::BeginPlay()
 {
     Super::BeginPlay();
 
+    // Publish goals, penalty areas and extents for O(1) lookup by players, AI and the ball
+    if (UMF_FieldLandmarksSubsystem *Landmarks = UMF_FieldLandmarksSubsystem::Get(this))
+    {
+        Landmarks->PublishField(this);
+    }
+
     if (HasAuthority())
     {
         EnsureNavMesh();
@@ -0,0 +1,267 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: MF_FieldLandmarks - Implementation
+ * @Date: 16/10/2026
+ */
+
+#include "Match/MF_FieldLandmarks.h"
+#include "Match/MF_Field.h"
+#include "Match/MF_Goal.h"
+#include "Match/MF_PenaltyArea.h"
+#include "Components/BoxComponent.h"
+#include "Engine/World.h"
+
+// ==================== FMF_FieldLandmarks ====================
+
+FMF_FieldLandmarks::FMF_FieldLandmarks()
+    : HalfExtent(MF_Constants::FieldWidth / 2.0f, MF_Constants::FieldLength / 2.0f)
+{
+    // TeamA defends +Y, TeamB defends -Y (matches AMF_Field's spawn layout at identity rotation)
+    const float HalfLength = MF_Constants::FieldLength / 2.0f;
+    const float PenaltyCenterY = HalfLength - MF_Constants::PenaltyAreaLength / 2.0f;
+    const FVector PenaltyExtent(MF_Constants::PenaltyAreaWidth / 2.0f, MF_Constants::PenaltyAreaLength / 2.0f, BIG_NUMBER);
+
+    for (int32 Slot = 0; Slot < 3; ++Slot)
+    {
+        GoalCenters[Slot] = FVector::ZeroVector;
+        AttackDirections[Slot] = FVector(0.0f, 1.0f, 0.0f);
+        PenaltyAreaTransforms[Slot] = FTransform::Identity;
+        PenaltyAreaExtents[Slot] = FVector::ZeroVector;
+    }
+
+    const uint8 A = static_cast<uint8>(EMF_TeamID::TeamA);
+    const uint8 B = static_cast<uint8>(EMF_TeamID::TeamB);
+
+    GoalCenters[A] = FVector(0.0f, HalfLength, MF_Constants::GroundZ);
+    GoalCenters[B] = FVector(0.0f, -HalfLength, MF_Constants::GroundZ);
+
+    PenaltyAreaTransforms[A].SetLocation(FVector(0.0f, PenaltyCenterY, MF_Constants::GroundZ));
+    PenaltyAreaTransforms[B].SetLocation(FVector(0.0f, -PenaltyCenterY, MF_Constants::GroundZ));
+    PenaltyAreaExtents[A] = PenaltyExtent;
+    PenaltyAreaExtents[B] = PenaltyExtent;
+
+    UpdateAttackDirections();
+    Zones.Build(*this);
+}
+
+bool FMF_FieldLandmarks::IsInPenaltyArea(EMF_TeamID DefendingTeam, const FVector &Location) const
+{
+    const uint8 Slot = static_cast<uint8>(DefendingTeam);
+    if (DefendingTeam == EMF_TeamID::None)
+    {
+        return false;
+    }
+
+    const FVector Local = PenaltyAreaTransforms[Slot].InverseTransformPositionNoScale(Location);
+    const FVector &Extent = PenaltyAreaExtents[Slot];
+    return FMath::Abs(Local.X) <= Extent.X && FMath::Abs(Local.Y) <= Extent.Y && FMath::Abs(Local.Z) <= Extent.Z;
+}
+
+bool FMF_FieldLandmarks::SweepBall(const FVector &From, const FVector &To, float Radius, FMF_BallCrossing &OutCrossing) const
+{
+    OutCrossing = FMF_BallCrossing();
+    float Earliest = 2.0f;
+
+    // Signed distance of the ball centre beyond each crossing plane (> 0: crossed)
+    auto TryLine = [&](float FromBeyond, float ToBeyond, EMF_BallCrossing Type, EMF_TeamID LineTeam)
+    {
+        if (ToBeyond <= 0.0f || ToBeyond <= FromBeyond)
+        {
+            return; // still in, or heading back in
+        }
+
+        const float Fraction = FromBeyond >= 0.0f ? 0.0f : FromBeyond / (FromBeyond - ToBeyond);
+        if (Fraction < Earliest)
+        {
+            Earliest = Fraction;
+            OutCrossing.Type = Type;
+            OutCrossing.LineTeam = LineTeam;
+        }
+    };
+
+    for (const EMF_TeamID Team : {EMF_TeamID::TeamA, EMF_TeamID::TeamB})
+    {
+        const float GoalLineY = GetGoalLineY(Team);
+        const float Outward = -GetAttackSign(Team);
+        TryLine((From.Y - GoalLineY) * Outward - Radius, (To.Y - GoalLineY) * Outward - Radius, EMF_BallCrossing::GoalLine, Team);
+    }
+
+    // Touchlines are side boards: the ball meets them while its centre is still Radius inside
+    const float TouchlineX = HalfExtent.X - Radius;
+    TryLine((From.X - CenterSpot.X) - TouchlineX, (To.X - CenterSpot.X) - TouchlineX, EMF_BallCrossing::Touchline, EMF_TeamID::None);
+    TryLine((CenterSpot.X - From.X) - TouchlineX, (CenterSpot.X - To.X) - TouchlineX, EMF_BallCrossing::Touchline, EMF_TeamID::None);
+
+    if (OutCrossing.Type == EMF_BallCrossing::None)
+    {
+        return false;
+    }
+
+    OutCrossing.Fraction = Earliest;
+    OutCrossing.Point = FMath::Lerp(From, To, Earliest);
+
+    // Over the goal line between the posts and under the bar
+    if (OutCrossing.Type == EMF_BallCrossing::GoalLine &&
+        FMath::Abs(OutCrossing.Point.X - CenterSpot.X) <= GoalHalfWidth &&
+        OutCrossing.Point.Z <= MF_Constants::GroundZ + GoalHeight)
+    {
+        OutCrossing.Type = EMF_BallCrossing::Goal;
+    }
+    return true;
+}
+
+void FMF_FieldLandmarks::UpdateAttackDirections()
+{
+    const uint8 A = static_cast<uint8>(EMF_TeamID::TeamA);
+    const uint8 B = static_cast<uint8>(EMF_TeamID::TeamB);
+
+    // Each team attacks from its own goal towards the other one
+    const FVector AToB = (GoalCenters[B] - GoalCenters[A]).GetSafeNormal2D();
+    if (!AToB.IsZero())
+    {
+        AttackDirections[A] = AToB;
+        AttackDirections[B] = -AToB;
+    }
+}
+
+// ==================== FMF_PitchZoneMap ====================
+
+void FMF_PitchZoneMap::Build(const FMF_FieldLandmarks &Landmarks)
+{
+    Min = FVector2D(Landmarks.CenterSpot.X, Landmarks.CenterSpot.Y) - Landmarks.HalfExtent;
+    CellsX = FMath::Max(1, FMath::CeilToInt32(Landmarks.HalfExtent.X * 2.0 / CellSize));
+    CellsY = FMath::Max(1, FMath::CeilToInt32(Landmarks.HalfExtent.Y * 2.0 / CellSize));
+
+    const float FieldLength = Landmarks.HalfExtent.Y * 2.0f;
+    const float GoalAreaHalfWidth = MF_Constants::GoalAreaWidth / 2.0f;
+
+    for (const EMF_TeamID Team : {EMF_TeamID::TeamA, EMF_TeamID::TeamB})
+    {
+        const EMF_TeamID Opponent = FMF_FieldLandmarks::Opponent(Team);
+        const uint8 OwnSlot = static_cast<uint8>(Team);
+
+        // Flanks: wider than the box (box width is the larger half-size of its box)
+        const FVector &BoxExtent = Landmarks.PenaltyAreaExtents[OwnSlot];
+        const float FlankX = FMath::Max(BoxExtent.X, BoxExtent.Y);
+        const float BoxZ = Landmarks.PenaltyAreaTransforms[OwnSlot].GetLocation().Z;
+
+        // Distance in from a team's goal line towards the centre spot
+        auto Inward = [&Landmarks](EMF_TeamID GoalTeam, float Y)
+        {
+            return (Y - Landmarks.GetGoalLineY(GoalTeam)) * Landmarks.GetAttackSign(GoalTeam);
+        };
+
+        TArray<EMF_PitchZone> &Cells = Masks[OwnSlot - 1];
+        Cells.SetNumUninitialized(CellsX * CellsY);
+
+        for (int32 Y = 0; Y < CellsY; ++Y)
+        {
+            const float CellY = static_cast<float>(Min.Y) + (Y + 0.5f) * CellSize;
+            const float FromOwnLine = Inward(Team, CellY);
+            const float FromOpponentLine = Inward(Opponent, CellY);
+
+            for (int32 X = 0; X < CellsX; ++X)
+            {
+                const float CellX = static_cast<float>(Min.X) + (X + 0.5f) * CellSize;
+                const float FromCenterX = FMath::Abs(CellX - static_cast<float>(Landmarks.CenterSpot.X));
+                const FVector Cell(CellX, CellY, BoxZ);
+
+                EMF_PitchZone Mask = EMF_PitchZone::None;
+                if (Landmarks.IsInPenaltyArea(Team, Cell))
+                {
+                    Mask |= EMF_PitchZone::OwnBox;
+                }
+                if (Landmarks.IsInPenaltyArea(Opponent, Cell))
+                {
+                    Mask |= EMF_PitchZone::OpponentBox;
+                }
+                if (FromCenterX <= GoalAreaHalfWidth && FromOwnLine >= 0.0f && FromOwnLine <= MF_Constants::GoalAreaLength)
+                {
+                    Mask |= EMF_PitchZone::OwnGoalArea;
+                }
+                if (FromCenterX <= GoalAreaHalfWidth && FromOpponentLine >= 0.0f && FromOpponentLine <= MF_Constants::GoalAreaLength)
+                {
+                    Mask |= EMF_PitchZone::OpponentGoalArea;
+                }
+
+                const float Progress = FromOwnLine / FieldLength;
+                Mask |= Progress < 1.0f / 3.0f ? EMF_PitchZone::DefensiveThird
+                                               : (Progress < 2.0f / 3.0f ? EMF_PitchZone::MiddleThird : EMF_PitchZone::AttackingThird);
+
+                if (FromCenterX > FlankX)
+                {
+                    Mask |= EMF_PitchZone::Flank;
+                }
+
+                Cells[Y * CellsX + X] = Mask;
+            }
+        }
+    }
+}
+
+// ==================== UMF_FieldLandmarksSubsystem ====================
+
+UMF_FieldLandmarksSubsystem *UMF_FieldLandmarksSubsystem::Get(const UObject *WorldContextObject)
+{
+    const UWorld *World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    return World ? World->GetSubsystem<UMF_FieldLandmarksSubsystem>() : nullptr;
+}
+
+const FMF_FieldLandmarks &UMF_FieldLandmarksSubsystem::GetLandmarks(const UObject *WorldContextObject)
+{
+    static const FMF_FieldLandmarks Defaults;
+    const UMF_FieldLandmarksSubsystem *Subsystem = Get(WorldContextObject);
+    return Subsystem ? Subsystem->Landmarks : Defaults;
+}
+
+void UMF_FieldLandmarksSubsystem::PublishField(const AMF_Field *Field)
+{
+    if (!Field || !Field->FieldBounds)
+    {
+        return;
+    }
+
+    const FVector Extent = Field->FieldBounds->GetScaledBoxExtent();
+    Landmarks.CenterSpot = Field->GetActorLocation();
+    Landmarks.HalfExtent = FVector2D(Extent.X, Extent.Y);
+    Landmarks.GoalHalfWidth = Field->GoalWidth / 2.0f;
+    Landmarks.GoalHeight = Field->GoalHeight;
+
+    // Goals / penalty areas the field spawned (they also publish themselves at BeginPlay)
+    PublishGoal(Field->GoalA);
+    PublishGoal(Field->GoalB);
+    PublishPenaltyArea(Field->PenaltyAreaA);
+    PublishPenaltyArea(Field->PenaltyAreaB);
+    Landmarks.Zones.Build(Landmarks);
+
+    UE_LOG(LogTemp, Log, TEXT("[MF_FieldLandmarks] Published field %s (HalfExtent %s)"),
+           *Field->GetName(), *Landmarks.HalfExtent.ToString());
+}
+
+void UMF_FieldLandmarksSubsystem::PublishGoal(AMF_Goal *Goal)
+{
+    if (!IsValid(Goal) || Goal->DefendingTeam == EMF_TeamID::None)
+    {
+        return;
+    }
+
+    const uint8 Slot = static_cast<uint8>(Goal->DefendingTeam);
+    Landmarks.Goals[Slot] = Goal;
+    Landmarks.GoalCenters[Slot] = Goal->GetActorLocation();
+    Landmarks.UpdateAttackDirections();
+    Landmarks.Zones.Build(Landmarks);
+}
+
+void UMF_FieldLandmarksSubsystem::PublishPenaltyArea(AMF_PenaltyArea *PenaltyArea)
+{
+    if (!IsValid(PenaltyArea) || PenaltyArea->DefendingTeam == EMF_TeamID::None)
+    {
+        return;
+    }
+
+    const uint8 Slot = static_cast<uint8>(PenaltyArea->DefendingTeam);
+    Landmarks.PenaltyAreas[Slot] = PenaltyArea;
+    Landmarks.PenaltyAreaTransforms[Slot] = PenaltyArea->GetActorTransform();
+    Landmarks.PenaltyAreaTransforms[Slot].SetScale3D(FVector::OneVector); // extent below is already scaled
+    Landmarks.PenaltyAreaExtents[Slot] = PenaltyArea->GetPenaltyAreaExtent();
+    Landmarks.Zones.Build(Landmarks);
+}
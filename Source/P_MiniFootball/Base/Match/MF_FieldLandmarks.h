@@ -0,0 +1,201 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: MF_FieldLandmarks - Per-world registry of field landmarks
+ *               Goals, penalty areas, centre spot, extents and each team's attack direction,
+ *               published by AMF_Field / AMF_Goal / AMF_PenaltyArea at BeginPlay so hot paths
+ *               never iterate the world or hard-code pitch numbers
+ * @Date: 16/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Core/MF_Types.h"
+#include "MF_FieldLandmarks.generated.h"
+
+class AMF_Field;
+class AMF_Goal;
+class AMF_PenaltyArea;
+struct FMF_FieldLandmarks;
+
+/**
+ * Pitch zones, relative to a team (own box = the box that team defends).
+ * Combined as a bitmask per zone-map cell.
+ */
+UENUM(BlueprintType, meta = (Bitflags, UseEnumValuesAsMaskValuesInEditor = "true"))
+enum class EMF_PitchZone : uint8
+{
+    None = 0 UMETA(Hidden),
+    OwnBox = 1 << 0 UMETA(DisplayName = "Own Penalty Box"),
+    OpponentBox = 1 << 1 UMETA(DisplayName = "Opponent Penalty Box"),
+    OwnGoalArea = 1 << 2 UMETA(DisplayName = "Own Goal Area"),
+    OpponentGoalArea = 1 << 3 UMETA(DisplayName = "Opponent Goal Area"),
+    DefensiveThird = 1 << 4 UMETA(DisplayName = "Defensive Third"),
+    MiddleThird = 1 << 5 UMETA(DisplayName = "Middle Third"),
+    AttackingThird = 1 << 6 UMETA(DisplayName = "Attacking Third"),
+    Flank = 1 << 7 UMETA(DisplayName = "Flank (outside box width)")
+};
+ENUM_CLASS_FLAGS(EMF_PitchZone);
+
+/**
+ * FMF_PitchZoneMap
+ * 1m grid over the pitch with one precomputed EMF_PitchZone mask per cell per team.
+ * Built from the landmarks whenever they are published; a lookup is one array index.
+ * Positions off the pitch clamp to the nearest edge cell.
+ */
+struct P_MINIFOOTBALL_API FMF_PitchZoneMap
+{
+    static constexpr float CellSize = 100.0f;
+
+    void Build(const FMF_FieldLandmarks &Landmarks);
+
+    EMF_PitchZone Get(EMF_TeamID Team, const FVector &Location) const
+    {
+        const int32 Slot = static_cast<int32>(Team) - 1;
+        if (Slot < 0 || Slot > 1 || Masks[Slot].Num() == 0)
+        {
+            return EMF_PitchZone::None;
+        }
+
+        const int32 X = FMath::Clamp(FMath::FloorToInt32((Location.X - Min.X) * InvCellSize), 0, CellsX - 1);
+        const int32 Y = FMath::Clamp(FMath::FloorToInt32((Location.Y - Min.Y) * InvCellSize), 0, CellsY - 1);
+        return Masks[Slot][Y * CellsX + X];
+    }
+
+private:
+    FVector2D Min = FVector2D::ZeroVector;
+    double InvCellSize = 1.0 / CellSize;
+    int32 CellsX = 0;
+    int32 CellsY = 0;
+
+    /** Per team (TeamA, TeamB), row-major */
+    TArray<EMF_PitchZone> Masks[2];
+};
+
+/**
+ * FMF_FieldLandmarks
+ * Plain data, valid from construction: defaults follow MF_Constants (pitch centred on the
+ * origin, width along X, length along Y, TeamA defending +Y) until actors publish real values.
+ * Per-team arrays are indexed by EMF_TeamID (slot 0 / None is unused).
+ */
+struct P_MINIFOOTBALL_API FMF_FieldLandmarks
+{
+    FMF_FieldLandmarks();
+
+    /** Centre spot */
+    FVector CenterSpot = FVector::ZeroVector;
+
+    /** Half-size of the playing area (X = width, Y = length) */
+    FVector2D HalfExtent;
+
+    /** Half-width of the goal mouth */
+    float GoalHalfWidth = MF_Constants::GoalWidth / 2.0f;
+
+    /** Crossbar height above the ground */
+    float GoalHeight = MF_Constants::GoalHeight;
+
+    /** Centre of the goal each team defends */
+    FVector GoalCenters[3];
+
+    /** Unit XY direction each team attacks in */
+    FVector AttackDirections[3];
+
+    /** Penalty area each team defends: world transform + half-size of its box */
+    FTransform PenaltyAreaTransforms[3];
+    FVector PenaltyAreaExtents[3];
+
+    /** Published actors (null if the level has none) */
+    TWeakObjectPtr<AMF_Goal> Goals[3];
+    TWeakObjectPtr<AMF_PenaltyArea> PenaltyAreas[3];
+
+    static EMF_TeamID Opponent(EMF_TeamID Team)
+    {
+        return Team == EMF_TeamID::TeamA ? EMF_TeamID::TeamB : (Team == EMF_TeamID::TeamB ? EMF_TeamID::TeamA : EMF_TeamID::None);
+    }
+
+    const FVector &GetOwnGoal(EMF_TeamID Team) const { return GoalCenters[static_cast<uint8>(Team)]; }
+    const FVector &GetOpponentGoal(EMF_TeamID Team) const { return GoalCenters[static_cast<uint8>(Opponent(Team))]; }
+    const FVector &GetAttackDirection(EMF_TeamID Team) const { return AttackDirections[static_cast<uint8>(Team)]; }
+
+    /** +1 / -1 along Y (pitch length) for the team's attack; TeamB for None */
+    float GetAttackSign(EMF_TeamID Team) const { return GetAttackDirection(Team).Y < 0.0f ? -1.0f : 1.0f; }
+
+    /** Y of the goal line Team defends (pitch is axis-aligned along Y) */
+    float GetGoalLineY(EMF_TeamID Team) const { return static_cast<float>(CenterSpot.Y) - GetAttackSign(Team) * static_cast<float>(HalfExtent.Y); }
+
+    /** True if Location is inside the penalty area DefendingTeam defends */
+    bool IsInPenaltyArea(EMF_TeamID DefendingTeam, const FVector &Location) const;
+
+    /** True if Location is on (or over) the playing area, with an optional margin */
+    bool IsOnField(const FVector &Location, float Margin = 0.0f) const
+    {
+        return FMath::Abs(Location.X - CenterSpot.X) <= HalfExtent.X + Margin &&
+               FMath::Abs(Location.Y - CenterSpot.Y) <= HalfExtent.Y + Margin;
+    }
+
+    /**
+     * Swept test of a ball (centre From -> To) against both goal lines and touchlines.
+     * A goal line counts as crossed once the whole ball is over it; a touchline (side boards) as soon
+     * as the ball touches it, so the rebound happens at the boards. Only balls moving outward cross
+     * (a ball already over a line crosses at Fraction 0). Reports the earliest crossing;
+     * OutCrossing.Time is left for the caller. Returns false if nothing was crossed.
+     */
+    bool SweepBall(const FVector &From, const FVector &To, float Radius, FMF_BallCrossing &OutCrossing) const;
+
+    /** Team-relative zones at Location (single lookup) */
+    EMF_PitchZone GetZones(EMF_TeamID Team, const FVector &Location) const { return Zones.Get(Team, Location); }
+
+    /** Recompute attack directions from the goal centres */
+    void UpdateAttackDirections();
+
+    /** Zone map; rebuilt by the subsystem whenever landmarks are published */
+    FMF_PitchZoneMap Zones;
+};
+
+/**
+ * UMF_FieldLandmarksSubsystem
+ * Owns the world's FMF_FieldLandmarks. Reads are O(1) and safe from any thread
+ * while gameplay runs (only written during BeginPlay of field actors).
+ */
+UCLASS()
+class P_MINIFOOTBALL_API UMF_FieldLandmarksSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /** Get the subsystem for a world context (nullptr if none) */
+    static UMF_FieldLandmarksSubsystem *Get(const UObject *WorldContextObject);
+
+    /** Landmarks for a world context; MF_Constants defaults if there is no world */
+    static const FMF_FieldLandmarks &GetLandmarks(const UObject *WorldContextObject);
+
+    const FMF_FieldLandmarks &GetLandmarks() const { return Landmarks; }
+
+    /** Goal actor a team defends (nullptr if none published) */
+    AMF_Goal *GetGoal(EMF_TeamID DefendingTeam) const { return Landmarks.Goals[static_cast<uint8>(DefendingTeam)].Get(); }
+
+    // ==================== Zones ====================
+    /** Zones (relative to Team) containing Location, as an EMF_PitchZone bitmask */
+    UFUNCTION(BlueprintPure, Category = "MiniFootball|Field")
+    UPARAM(meta = (Bitmask, BitmaskEnum = "/Script/P_MiniFootball.EMF_PitchZone")) int32 GetZonesAt(EMF_TeamID Team, FVector Location) const
+    {
+        return static_cast<int32>(Landmarks.GetZones(Team, Location));
+    }
+
+    /** True if Location is in Zone, relative to Team */
+    UFUNCTION(BlueprintPure, Category = "MiniFootball|Field")
+    bool IsInZone(EMF_TeamID Team, FVector Location, EMF_PitchZone Zone) const
+    {
+        return EnumHasAnyFlags(Landmarks.GetZones(Team, Location), Zone);
+    }
+
+    // ==================== Publishing ====================
+    /** Field extents/centre plus any goals and penalty areas the field spawned */
+    void PublishField(const AMF_Field *Field);
+    void PublishGoal(AMF_Goal *Goal);
+    void PublishPenaltyArea(AMF_PenaltyArea *PenaltyArea);
+
+private:
+    FMF_FieldLandmarks Landmarks;
+};
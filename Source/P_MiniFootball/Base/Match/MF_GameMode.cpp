@@ -309,6 +309,12 @@ AMF_PlayerCharacter *AMF_GameMode::SpawnTeamCharacter(EMF_TeamID Team, int32 Spa
         Character->SetTeamID(Team);
         Character->SetPlayerID(SpawnIndex);
 
+        // Match-wide slot: spawn order across both teams, never reused within the match
+        if (SpawnedCharacters.Num() < MF_Constants::InvalidMatchSlot)
+        {
+            Character->SetMatchSlot(static_cast<uint8>(SpawnedCharacters.Num()));
+        }
+
         // Assign Role based on formation index
         FString AIRoleName = TEXT("Striker");
         if (SpawnIndex == 0) AIRoleName = TEXT("Goalkeeper");
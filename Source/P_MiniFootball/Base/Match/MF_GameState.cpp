@@ -9,6 +9,7 @@
 #include "Ball/MF_Ball.h"
 #include "Player/MF_PlayerCharacter.h"
 #include "Net/UnrealNetwork.h"
+#include "Net/Core/PushModel/PushModel.h"
 #include "TimerManager.h"
 #include "GameFramework/PlayerState.h"
 
@@ -35,15 +36,19 @@ void AMF_GameState::GetLifetimeReplicatedProps(TArray<FLifetimeProperty> &OutLif
 {
     Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
-    DOREPLIFETIME(AMF_GameState, CurrentPhase);
-    DOREPLIFETIME(AMF_GameState, ScoreTeamA);
-    DOREPLIFETIME(AMF_GameState, ScoreTeamB);
-    DOREPLIFETIME(AMF_GameState, MatchTimeRemaining);
-    DOREPLIFETIME(AMF_GameState, CurrentHalf);
-    DOREPLIFETIME(AMF_GameState, KickoffTeam);
-    DOREPLIFETIME(AMF_GameState, TeamAPlayers);
-    DOREPLIFETIME(AMF_GameState, TeamBPlayers);
-    DOREPLIFETIME(AMF_GameState, MatchBall);
+    // Push model: match state changes a few times per match, so only marked properties are compared
+    FDoRepLifetimeParams Params;
+    Params.bIsPushBased = true;
+
+    DOREPLIFETIME_WITH_PARAMS_FAST(AMF_GameState, CurrentPhase, Params);
+    DOREPLIFETIME_WITH_PARAMS_FAST(AMF_GameState, ScoreTeamA, Params);
+    DOREPLIFETIME_WITH_PARAMS_FAST(AMF_GameState, ScoreTeamB, Params);
+    DOREPLIFETIME_WITH_PARAMS_FAST(AMF_GameState, MatchTimeRemaining, Params);
+    DOREPLIFETIME_WITH_PARAMS_FAST(AMF_GameState, CurrentHalf, Params);
+    DOREPLIFETIME_WITH_PARAMS_FAST(AMF_GameState, KickoffTeam, Params);
+    DOREPLIFETIME_WITH_PARAMS_FAST(AMF_GameState, TeamAPlayers, Params);
+    DOREPLIFETIME_WITH_PARAMS_FAST(AMF_GameState, TeamBPlayers, Params);
+    DOREPLIFETIME_WITH_PARAMS_FAST(AMF_GameState, MatchBall, Params);
 }
 
 void AMF_GameState::BeginPlay()
@@ -79,6 +84,10 @@ void AMF_GameState::StartMatch()
     ScoreTeamB = 0;
     CurrentHalf = 1;
     MatchTimeRemaining = HalfDuration;
+    MARK_PROPERTY_DIRTY_FROM_NAME(AMF_GameState, ScoreTeamA, this);
+    MARK_PROPERTY_DIRTY_FROM_NAME(AMF_GameState, ScoreTeamB, this);
+    MARK_PROPERTY_DIRTY_FROM_NAME(AMF_GameState, CurrentHalf, this);
+    MARK_PROPERTY_DIRTY_FROM_NAME(AMF_GameState, MatchTimeRemaining, this);
 
     // Start with kickoff
     ResetForKickoff(EMF_TeamID::TeamA);
@@ -129,11 +138,13 @@ void AMF_GameState::AddScore(EMF_TeamID Team, int32 Points)
     if (Team == EMF_TeamID::TeamA)
     {
         ScoreTeamA += Points;
+        MARK_PROPERTY_DIRTY_FROM_NAME(AMF_GameState, ScoreTeamA, this);
         OnRep_ScoreTeamA();
     }
     else if (Team == EMF_TeamID::TeamB)
     {
         ScoreTeamB += Points;
+        MARK_PROPERTY_DIRTY_FROM_NAME(AMF_GameState, ScoreTeamB, this);
         OnRep_ScoreTeamB();
     }
 
@@ -168,6 +179,7 @@ void AMF_GameState::SetMatchPhase(EMF_MatchPhase NewPhase)
     if (CurrentPhase != NewPhase)
     {
         CurrentPhase = NewPhase;
+        MARK_PROPERTY_DIRTY_FROM_NAME(AMF_GameState, CurrentPhase, this);
 
         // Handle timer based on phase
         switch (NewPhase)
@@ -223,6 +235,7 @@ void AMF_GameState::ResetForKickoff(EMF_TeamID Team)
     }
 
     KickoffTeam = Team;
+    MARK_PROPERTY_DIRTY_FROM_NAME(AMF_GameState, KickoffTeam, this);
     SetMatchPhase(EMF_MatchPhase::Kickoff);
 
     // Reset ball to center
@@ -250,6 +263,7 @@ void AMF_GameState::RegisterBall(AMF_Ball *Ball)
     }
 
     MatchBall = Ball;
+    MARK_PROPERTY_DIRTY_FROM_NAME(AMF_GameState, MatchBall, this);
 
     // Bind to ball events
     if (MatchBall)
@@ -283,10 +297,12 @@ void AMF_GameState::RegisterPlayer(AMF_PlayerCharacter *Player, EMF_TeamID Team)
     if (Team == EMF_TeamID::TeamA)
     {
         TeamAPlayers.Add(Player);
+        MARK_PROPERTY_DIRTY_FROM_NAME(AMF_GameState, TeamAPlayers, this);
     }
     else if (Team == EMF_TeamID::TeamB)
     {
         TeamBPlayers.Add(Player);
+        MARK_PROPERTY_DIRTY_FROM_NAME(AMF_GameState, TeamBPlayers, this);
     }
 
     // Set player's team
@@ -303,8 +319,14 @@ void AMF_GameState::UnregisterPlayer(AMF_PlayerCharacter *Player)
         return;
     }
 
-    TeamAPlayers.Remove(Player);
-    TeamBPlayers.Remove(Player);
+    if (TeamAPlayers.Remove(Player) > 0)
+    {
+        MARK_PROPERTY_DIRTY_FROM_NAME(AMF_GameState, TeamAPlayers, this);
+    }
+    if (TeamBPlayers.Remove(Player) > 0)
+    {
+        MARK_PROPERTY_DIRTY_FROM_NAME(AMF_GameState, TeamBPlayers, this);
+    }
 }
 
 TArray<AMF_PlayerCharacter *> AMF_GameState::GetTeamPlayers(EMF_TeamID Team) const
@@ -420,6 +442,16 @@ AMF_Ball *AMF_GameState::GetMatchBall() const
     return MatchBall;
 }
 
+uint8 AMF_GameState::GetBallSlot(const AMF_Ball *Ball) const
+{
+    return (Ball && Ball == MatchBall) ? 0 : 0xFF;
+}
+
+AMF_Ball *AMF_GameState::GetBallBySlot(uint8 Slot) const
+{
+    return Slot == 0 ? MatchBall : nullptr;
+}
+
 EMF_TeamID AMF_GameState::GetTeamForController(APlayerController *PC) const
 {
     if (!PC)
@@ -510,8 +542,15 @@ void AMF_GameState::UpdateMatchTimer(float DeltaTime)
         return;
     }
 
+    const int32 ShownSeconds = FMath::FloorToInt(MatchTimeRemaining);
     MatchTimeRemaining -= DeltaTime;
 
+    // The clock is shown in whole seconds; replicate it once per second, not every tick
+    if (FMath::FloorToInt(MatchTimeRemaining) != ShownSeconds)
+    {
+        MARK_PROPERTY_DIRTY_FROM_NAME(AMF_GameState, MatchTimeRemaining, this);
+    }
+
     if (MatchTimeRemaining <= 0.0f)
     {
         MatchTimeRemaining = 0.0f;
@@ -546,6 +585,8 @@ void AMF_GameState::HandleHalfTime()
     EMF_TeamID NextKickoff = (KickoffTeam == EMF_TeamID::TeamA) ? EMF_TeamID::TeamB : EMF_TeamID::TeamA;
     CurrentHalf = 2;
     MatchTimeRemaining = HalfDuration;
+    MARK_PROPERTY_DIRTY_FROM_NAME(AMF_GameState, CurrentHalf, this);
+    MARK_PROPERTY_DIRTY_FROM_NAME(AMF_GameState, MatchTimeRemaining, this);
 
     // Resume after halftime break
     FTimerDelegate TimerDel;
@@ -167,6 +167,12 @@ public:
     UFUNCTION(BlueprintPure, Category = "Ball")
     AMF_Ball *GetMatchBall() const;
 
+    /** Ball slot replicated in place of a ball pointer (0 = match ball, 0xFF = not a slotted ball) */
+    uint8 GetBallSlot(const AMF_Ball *Ball) const;
+
+    /** Resolve a replicated ball slot (null if unknown or not replicated yet) */
+    AMF_Ball *GetBallBySlot(uint8 Slot) const;
+
     /** Get team for a controller (authoritative resolution) */
     UFUNCTION(BlueprintPure, Category = "Teams")
     EMF_TeamID GetTeamForController(APlayerController *PC) const;
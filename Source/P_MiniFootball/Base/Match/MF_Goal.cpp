@@ -1,16 +1,14 @@
 /*
  * @Author: Punal Manalan
  * @Description: MF_Goal - Implementation
- *               Goal trigger volume for detecting ball entry
+ *               Goal mouth volume; goal events come from the ball's swept goal-line test
  * @Date: 07/12/2025
  */
 
 #include "Match/MF_Goal.h"
-#include "Match/MF_GameState.h"
+#include "Match/MF_FieldLandmarks.h"
 #include "Ball/MF_Ball.h"
 #include "Components/BoxComponent.h"
-#include "Kismet/GameplayStatics.h"
-#include "TimerManager.h"
 #include "DrawDebugHelpers.h"
 
 AMF_Goal::AMF_Goal()
@@ -25,10 +23,9 @@ AMF_Goal::AMF_Goal()
     // Create goal trigger box
     GoalTrigger = CreateDefaultSubobject<UBoxComponent>(TEXT("GoalTrigger"));
     GoalTrigger->SetBoxExtent(FVector(50.0f, MF_Constants::GoalWidth / 2.0f, MF_Constants::GoalHeight / 2.0f));
-    GoalTrigger->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+    GoalTrigger->SetCollisionEnabled(ECollisionEnabled::NoCollision);
     GoalTrigger->SetCollisionObjectType(ECollisionChannel::ECC_WorldStatic);
-    GoalTrigger->SetCollisionResponseToAllChannels(ECollisionResponse::ECR_Overlap);
-    GoalTrigger->SetGenerateOverlapEvents(true);
+    GoalTrigger->SetGenerateOverlapEvents(false);
     RootComponent = GoalTrigger;
 
     // Network - only server needs to detect goals
@@ -42,10 +39,10 @@ void AMF_Goal::BeginPlay()
 {
     Super::BeginPlay();
 
-    // Bind overlap event
-    if (GoalTrigger)
+    // Goals placed by hand (no AMF_Field) still need to be found by AI targeting
+    if (UMF_FieldLandmarksSubsystem *Landmarks = UMF_FieldLandmarksSubsystem::Get(this))
     {
-        GoalTrigger->OnComponentBeginOverlap.AddDynamic(this, &AMF_Goal::OnGoalOverlap);
+        Landmarks->PublishGoal(this);
     }
 
 #if !UE_BUILD_SHIPPING
@@ -81,61 +78,13 @@ void AMF_Goal::Tick(float DeltaTime)
 }
 #endif
 
-void AMF_Goal::OnGoalOverlap(UPrimitiveComponent *OverlappedComponent, AActor *OtherActor,
-                             UPrimitiveComponent *OtherComp, int32 OtherBodyIndex,
-                             bool bFromSweep, const FHitResult &SweepResult)
+void AMF_Goal::NotifyBallEntered(AMF_Ball *Ball)
 {
-    // Only process on server
-    if (!HasAuthority())
+    if (!HasAuthority() || !Ball)
     {
         return;
     }
 
-    // Prevent multiple triggers for same goal
-    if (bGoalScoredThisFrame)
-    {
-        return;
-    }
-
-    // Check if it's the ball
-    AMF_Ball *Ball = Cast<AMF_Ball>(OtherActor);
-    if (!Ball)
-    {
-        return;
-    }
-
-    // Make sure we have a valid team
-    if (DefendingTeam == EMF_TeamID::None)
-    {
-        UE_LOG(LogTemp, Warning, TEXT("MF_Goal::OnGoalOverlap - GoalTeam not set!"));
-        return;
-    }
-
-    // Score! The OPPOSITE of DefendingTeam scores when ball enters this goal
-    EMF_TeamID ScoringTeam = (DefendingTeam == EMF_TeamID::TeamA) ? EMF_TeamID::TeamB : EMF_TeamID::TeamA;
-
-    // Prevent multiple detections
-    bGoalScoredThisFrame = true;
-
-    // Reset flag after short delay
-    FTimerHandle TimerHandle;
-    GetWorld()->GetTimerManager().SetTimer(TimerHandle, this, &AMF_Goal::ResetGoalFlag, 2.0f, false);
-
-    // Notify game state
-    AMF_GameState *GS = Cast<AMF_GameState>(UGameplayStatics::GetGameState(this));
-    if (GS)
-    {
-        GS->AddScore(ScoringTeam, 1);
-    }
-
-    // Broadcast event
+    // Scoring itself goes through AMF_Ball::OnGoalScored -> AMF_GameState, exactly once per goal
     OnGoalTriggered.Broadcast(this, Ball);
-
-    // Reset ball to center
-    Ball->ResetToPosition(FVector(0.0f, 0.0f, MF_Constants::GroundZ + MF_Constants::BallRadius + MF_Constants::CharacterSpawnZOffset));
-}
-
-void AMF_Goal::ResetGoalFlag()
-{
-    bGoalScoredThisFrame = false;
 }
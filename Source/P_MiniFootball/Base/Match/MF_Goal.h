@@ -1,7 +1,7 @@
 /*
  * @Author: Punal Manalan
- * @Description: MF_Goal - Goal Trigger Volume
- *               Detects when ball enters goal area
+ * @Description: MF_Goal - Goal Volume
+ *               Marks a goal mouth; the ball's swept goal-line test reports goals
  * @Date: 07/12/2025
  */
 
@@ -24,8 +24,9 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnGoalTriggered, AMF_Goal *, Goal,
  * - Goal A at one end (set GoalTeam to TeamA)
  * - Goal B at other end (set GoalTeam to TeamB)
  *
- * When the ball enters, it broadcasts OnGoalTriggered
- * and notifies the GameState to score.
+ * Goals are detected by AMF_Ball's swept goal-line test (one event per goal,
+ * scored through AMF_Ball::OnGoalScored). The ball then calls NotifyBallEntered
+ * so this goal broadcasts OnGoalTriggered; the volume itself generates no overlaps.
  */
 UCLASS()
 class P_MINIFOOTBALL_API AMF_Goal : public AActor
@@ -37,7 +38,7 @@ public:
 
     // ==================== Components ====================
 
-    /** Trigger volume for goal detection */
+    /** Goal mouth volume (extents for aiming/debug; no overlap events) */
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
     UBoxComponent *GoalTrigger;
 
@@ -53,6 +54,9 @@ public:
     UPROPERTY(BlueprintAssignable, Category = "Events")
     FOnGoalTriggered OnGoalTriggered;
 
+    /** Called by the ball when it crosses this goal's line between the posts (server only) */
+    void NotifyBallEntered(AMF_Ball *Ball);
+
 #if WITH_EDITORONLY_DATA
     /** Enable debug visualization in editor */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Debug")
@@ -65,18 +69,4 @@ protected:
 #if !UE_BUILD_SHIPPING
     virtual void Tick(float DeltaTime) override;
 #endif
-
-    /** Called when something overlaps the goal trigger */
-    UFUNCTION()
-    void OnGoalOverlap(UPrimitiveComponent *OverlappedComponent, AActor *OtherActor,
-                       UPrimitiveComponent *OtherComp, int32 OtherBodyIndex,
-                       bool bFromSweep, const FHitResult &SweepResult);
-
-private:
-    /** Prevent multiple goal detections for same ball entry */
-    bool bGoalScoredThisFrame = false;
-
-    /** Reset the goal scored flag after a delay */
-    UFUNCTION()
-    void ResetGoalFlag();
 };
@@ -5,6 +5,7 @@
  */
 
 #include "Match/MF_PenaltyArea.h"
+#include "Match/MF_FieldLandmarks.h"
 
 #include "Components/BoxComponent.h"
 #include "DrawDebugHelpers.h"
@@ -43,6 +44,11 @@ void AMF_PenaltyArea::BeginPlay()
 {
     Super::BeginPlay();
 
+    if (UMF_FieldLandmarksSubsystem *Landmarks = UMF_FieldLandmarksSubsystem::Get(this))
+    {
+        Landmarks->PublishPenaltyArea(this);
+    }
+
 #if !UE_BUILD_SHIPPING
 #if WITH_EDITORONLY_DATA
     if (bShowDebugInEditor)
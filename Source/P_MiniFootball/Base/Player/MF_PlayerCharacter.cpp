@@ -12,7 +12,11 @@
 #include "Ball/MF_Ball.h"
 #include "Match/MF_Goal.h"
 #include "Match/MF_GameState.h"
+#include "Match/MF_FieldLandmarks.h"
+#include "Core/MF_PlayerSnapshotSubsystem.h"
+#include "Settings/MF_NetworkSettings.h"
 #include "Net/UnrealNetwork.h"
+#include "Net/Core/PushModel/PushModel.h"
 
 #include "GameFramework/CharacterMovementComponent.h"
 #include "GameFramework/PlayerController.h"
@@ -31,6 +35,10 @@
 #include "AIController.h"
 #include "Navigation/PathFollowingComponent.h"
 #include "AI/MF_EAISActionExecutorComponent.h"
+#include "AI/MF_BlackboardWriter.h"
+#include "AI/MF_AISyncScheduler.h"
+#include "AI/MF_LaneClearance.h"
+#include "AI/MF_PitchControl.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
 #include "Interfaces/IPluginManager.h"
@@ -147,24 +155,84 @@ void AMF_PlayerCharacter::GetLifetimeReplicatedProps(TArray<FLifetimeProperty> &
 {
     Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
-    // Replicate to all clients
-    DOREPLIFETIME(AMF_PlayerCharacter, TeamID);
-    DOREPLIFETIME(AMF_PlayerCharacter, PlayerID);
-    DOREPLIFETIME(AMF_PlayerCharacter, bHasBall);
-    DOREPLIFETIME(AMF_PlayerCharacter, CurrentPlayerState);
-    DOREPLIFETIME(AMF_PlayerCharacter, bIsSprinting);
-    DOREPLIFETIME(AMF_PlayerCharacter, CurrentBall);
-    DOREPLIFETIME(AMF_PlayerCharacter, AIProfile);
+    // Replicate to all clients (push model: setters repack and mark it via PublishReplicatedState)
+    FDoRepLifetimeParams Params;
+    Params.bIsPushBased = true;
+
+    DOREPLIFETIME_WITH_PARAMS_FAST(AMF_PlayerCharacter, ReplicatedState, Params);
+}
+
+float AMF_PlayerCharacter::GetNetPriority(const FVector &ViewPos, const FVector &ViewDir, AActor *Viewer, AActor *ViewTarget,
+                                          UActorChannel *InChannel, float Time, bool bLowBandwidth)
+{
+    const UMF_NetworkSettings *Settings = UMF_NetworkSettings::Get();
+    const float TierScale = Settings->bAdaptiveNetUpdateFrequency ? Settings->GetTier(NetActivity).PriorityScale : 1.0f;
+
+    if (!Settings->bSpatialNetPriority)
+    {
+        return Super::GetNetPriority(ViewPos, ViewDir, Viewer, ViewTarget, InChannel, Time, bLowBandwidth) * TierScale;
+    }
+
+    // The distance falloff below replaces AActor's own view-cone/distance weighting instead of compounding with it
+    const float Priority = NetPriority * Time * TierScale;
+    if (ViewTarget == this || (Viewer && GetController() == Viewer))
+    {
+        // The viewer's own character is never throttled (engine view target boost)
+        return Priority * 4.0f;
+    }
+
+    // Viewer focus: whatever it is looking through (own character, spectator camera), else the camera itself
+    const FVector Focus = ViewTarget ? ViewTarget->GetActorLocation() : ViewPos;
+    const FVector Location = GetActorLocation();
+    float Distance = FVector::Dist2D(Location, Focus);
+
+    // Play around the ball matters to every viewer
+    if (UMF_PlayerSnapshotSubsystem *Snapshots = UMF_PlayerSnapshotSubsystem::Get(this))
+    {
+        const FMF_PlayerSnapshot &Snapshot = Snapshots->GetSnapshot();
+        if (Snapshot.Ball)
+        {
+            Distance = FMath::Min(Distance, FVector::Dist2D(Location, Snapshot.BallLocation));
+        }
+    }
+
+    return Priority * Settings->GetDistancePriorityScale(Distance);
+}
+
+void AMF_PlayerCharacter::UpdateNetActivity()
+{
+    const UMF_NetworkSettings *Settings = UMF_NetworkSettings::Get();
+    if (!Settings->bAdaptiveNetUpdateFrequency)
+    {
+        return;
+    }
+
+    float BallDistance = MAX_flt;
+    if (UMF_PlayerSnapshotSubsystem *Snapshots = UMF_PlayerSnapshotSubsystem::Get(this))
+    {
+        const FMF_PlayerSnapshot &Snapshot = Snapshots->GetSnapshot();
+        if (Snapshot.Ball)
+        {
+            BallDistance = FVector::Dist2D(GetActorLocation(), Snapshot.BallLocation);
+        }
+    }
+
+    const EMF_NetActivity Activity = Settings->ClassifyPlayer(IsStunned(), HasBall(), GetVelocity().Size2D(), BallDistance);
+    Settings->ApplyNetActivity(*this, NetActivity, Activity);
 }
 
 void AMF_PlayerCharacter::BeginPlay()
 {
     Super::BeginPlay();
 
+    // AIProfile may have been set in the editor/Blueprint without going through SetAIProfile
+    RefreshPlayerRole();
+    PublishReplicatedState();
+
     // Ensure Goalkeepers have an Actor Tag for reliable identification.
     // Prefer setting this tag in the Blueprint defaults; this is a safety net.
     static const FName GoalkeeperTag(TEXT("Goalkeeper"));
-    if (!ActorHasTag(GoalkeeperTag) && AIProfile.Contains(TEXT("Goalkeeper")))
+    if (!ActorHasTag(GoalkeeperTag) && PlayerRole == EMF_PlayerRole::Goalkeeper)
     {
         Tags.Add(GoalkeeperTag);
         UE_LOG(LogTemp, Warning, TEXT("[MF_PlayerCharacter] Auto-added Actor Tag '%s' to %s based on AIProfile. Prefer setting the tag in BP."),
@@ -174,6 +242,12 @@ void AMF_PlayerCharacter::BeginPlay()
     UE_LOG(LogTemp, Log, TEXT("MF_PlayerCharacter::BeginPlay - HasAuthority: %d, IsLocallyControlled: %d"),
            HasAuthority(), IsLocallyControlled());
 
+    // Register with the per-frame player snapshot shared by AI, tackling and ball pickup
+    if (UMF_PlayerSnapshotSubsystem *Snapshots = UMF_PlayerSnapshotSubsystem::Get(this))
+    {
+        Snapshots->RegisterPlayer(this);
+    }
+
     // Log spawn position and store for formation-based AI positioning
     SpawnLocation = GetActorLocation();
     UE_LOG(LogTemp, Log, TEXT("MF_PlayerCharacter::BeginPlay - Spawned at Location: %s"), *SpawnLocation.ToString());
@@ -245,6 +319,8 @@ void AMF_PlayerCharacter::BeginPlay()
                  if (AIComponent)
                  {
                      AIComponent->StartAI(AIProfile, AIProfileDir);
+                     BlackboardWriter.Invalidate();
+                     RegisterWithAISyncScheduler();
                  }
             }
             else
@@ -272,6 +348,21 @@ void AMF_PlayerCharacter::BeginPlay()
     UpdatePlayerIndicator();
 }
 
+void AMF_PlayerCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UMF_AISyncScheduler *Scheduler = UMF_AISyncScheduler::Get(this))
+    {
+        Scheduler->UnregisterAgent(this);
+    }
+
+    if (UMF_PlayerSnapshotSubsystem *Snapshots = UMF_PlayerSnapshotSubsystem::Get(this))
+    {
+        Snapshots->UnregisterPlayer(this);
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
 void AMF_PlayerCharacter::Tick(float DeltaTime)
 {
     Super::Tick(DeltaTime);
@@ -279,8 +370,8 @@ void AMF_PlayerCharacter::Tick(float DeltaTime)
     // Update movement
     UpdateMovement(DeltaTime);
 
-    // Sync game state to blackboard
-    if (HasAuthority() && AIComponent && AIComponent->IsValid() && IsAIRunning())
+    // Sync game state to blackboard (scheduled agents are synced just before their AI tick instead)
+    if (HasAuthority() && AIComponent && AIComponent->IsValid() && IsAIRunning() && !bBlackboardSyncScheduled)
     {
         SyncBlackboard();
         
@@ -307,6 +398,8 @@ void AMF_PlayerCharacter::Tick(float DeltaTime)
                 SetPlayerState(EMF_PlayerState::Idle);
             }
         }
+
+        UpdateNetActivity();
     }
 
     // Dynamic Billboarding: Make indicator face the camera on non-dedicated servers
@@ -448,7 +541,13 @@ void AMF_PlayerCharacter::SetTeamID(EMF_TeamID NewTeam)
     if (HasAuthority())
     {
         TeamID = NewTeam;
+        PublishReplicatedState();
         OnRep_TeamID();
+
+        if (UMF_PlayerSnapshotSubsystem *Snapshots = UMF_PlayerSnapshotSubsystem::Get(this))
+        {
+            Snapshots->Invalidate();
+        }
     }
 }
 
@@ -459,25 +558,69 @@ void AMF_PlayerCharacter::SetHasBall(bool bNewHasBall)
         if (bHasBall != bNewHasBall)
         {
             bHasBall = bNewHasBall;
+            PublishReplicatedState();
             UE_LOG(LogTemp, Log, TEXT("MF_PlayerCharacter[%s]::SetHasBall - New Value: %d"), *GetName(), bHasBall);
+
+            // Possession changed mid-frame: make later snapshot readers see it
+            if (UMF_PlayerSnapshotSubsystem *Snapshots = UMF_PlayerSnapshotSubsystem::Get(this))
+            {
+                Snapshots->Invalidate();
+            }
             OnRep_HasBall();
         }
     }
 }
 
+void AMF_PlayerCharacter::SetPlayerID(uint8 NewID)
+{
+    PlayerID = NewID;
+    PublishReplicatedState();
+}
+
+void AMF_PlayerCharacter::SetMatchSlot(uint8 NewSlot)
+{
+    if (HasAuthority() && MatchSlot != NewSlot)
+    {
+        MatchSlot = NewSlot;
+        PublishReplicatedState();
+
+        // Re-register so slot lookups see the new slot
+        if (UMF_PlayerSnapshotSubsystem *Snapshots = UMF_PlayerSnapshotSubsystem::Get(this))
+        {
+            Snapshots->RegisterPlayer(this);
+        }
+    }
+}
+
 void AMF_PlayerCharacter::SetPossessedBall(AMF_Ball *Ball)
 {
     PossessedBall = Ball;
 }
 
+void AMF_PlayerCharacter::SetCurrentBall(AMF_Ball *Ball)
+{
+    CurrentBall = Ball;
+    PublishReplicatedState();
+}
+
 void AMF_PlayerCharacter::SetPlayerState(EMF_PlayerState NewState)
 {
     if (HasAuthority())
     {
         if (CurrentPlayerState != NewState)
         {
+            const bool bStunChanged = (CurrentPlayerState == EMF_PlayerState::Stunned) != (NewState == EMF_PlayerState::Stunned);
             CurrentPlayerState = NewState;
+            PublishReplicatedState();
             UE_LOG(LogTemp, Log, TEXT("MF_PlayerCharacter[%s]::SetPlayerState - New State: %d"), *GetName(), (int32)CurrentPlayerState);
+
+            if (bStunChanged)
+            {
+                if (UMF_PlayerSnapshotSubsystem *Snapshots = UMF_PlayerSnapshotSubsystem::Get(this))
+                {
+                    Snapshots->Invalidate();
+                }
+            }
             OnRep_CurrentPlayerState();
         }
     }
@@ -499,6 +642,7 @@ void AMF_PlayerCharacter::SetSprinting(bool bNewSprinting)
     if (bIsSprinting != bNewSprinting)
     {
         bIsSprinting = bNewSprinting;
+        PublishReplicatedState();
 
         // Prediction-driven sprint: encode sprint intent into saved moves (owning client)
         // and apply it deterministically on both client/server via UMF_CharacterMovementComponent.
@@ -582,6 +726,7 @@ void AMF_PlayerCharacter::Server_SendMoveInput_Implementation(FVector2D MoveInpu
         if (bIsSprinting != bSprinting)
         {
             bIsSprinting = bSprinting;
+            PublishReplicatedState();
             if (UCharacterMovementComponent *Movement = GetCharacterMovement())
             {
                 Movement->MaxWalkSpeed = bIsSprinting ? MF_Constants::SprintSpeed : MF_Constants::WalkSpeed;
@@ -592,6 +737,103 @@ void AMF_PlayerCharacter::Server_SendMoveInput_Implementation(FVector2D MoveInpu
 
 // ==================== Rep Notifies ====================
 
+void AMF_PlayerCharacter::PublishReplicatedState()
+{
+    if (!HasAuthority())
+    {
+        return;
+    }
+
+    FMF_PlayerReplicationData Packed;
+    Packed.TeamID = TeamID;
+    Packed.PlayerID = PlayerID;
+    Packed.MatchSlot = MatchSlot;
+    Packed.Role = PlayerRole;
+    Packed.State = CurrentPlayerState;
+    Packed.bIsSprinting = bIsSprinting;
+    Packed.bHasBall = bHasBall;
+    if (bHasBall)
+    {
+        const AMF_GameState *GS = GetWorld() ? GetWorld()->GetGameState<AMF_GameState>() : nullptr;
+        Packed.BallSlot = GS ? GS->GetBallSlot(CurrentBall) : FMF_PlayerReplicationData::UnknownBallSlot;
+    }
+
+    if (Packed != ReplicatedState)
+    {
+        ReplicatedState = Packed;
+        MARK_PROPERTY_DIRTY_FROM_NAME(AMF_PlayerCharacter, ReplicatedState, this);
+
+        // Possession, stun and team changes go out now, not at the next send of a slow (Idle) tier
+        ForceNetUpdate();
+    }
+}
+
+void AMF_PlayerCharacter::OnRep_ReplicatedState()
+{
+    const FMF_PlayerReplicationData &Data = ReplicatedState;
+
+    PlayerID = Data.PlayerID;
+    bIsSprinting = Data.bIsSprinting;
+
+    if (MatchSlot != Data.MatchSlot)
+    {
+        MatchSlot = Data.MatchSlot;
+        if (UMF_PlayerSnapshotSubsystem *Snapshots = UMF_PlayerSnapshotSubsystem::Get(this))
+        {
+            Snapshots->RegisterPlayer(this);
+        }
+    }
+
+    if (TeamID != Data.TeamID)
+    {
+        TeamID = Data.TeamID;
+        OnRep_TeamID();
+    }
+
+    if (PlayerRole != Data.Role && Data.Role != EMF_PlayerRole::None)
+    {
+        AIProfile = MF_Roles::ToProfileName(Data.Role);
+        OnRep_AIProfile();
+    }
+
+    if (CurrentPlayerState != Data.State)
+    {
+        CurrentPlayerState = Data.State;
+        OnRep_CurrentPlayerState();
+    }
+
+    if (bHasBall != Data.bHasBall)
+    {
+        bHasBall = Data.bHasBall;
+        OnRep_HasBall();
+    }
+    ResolveCurrentBall();
+
+    // The ball replicates its possessor by our slot; it may have arrived before we did
+    if (CurrentBall)
+    {
+        CurrentBall->ResolvePossessor();
+    }
+}
+
+void AMF_PlayerCharacter::ResolveCurrentBall(AMF_Ball *Fallback)
+{
+    AMF_Ball *Resolved = nullptr;
+    if (ReplicatedState.bHasBall)
+    {
+        const AMF_GameState *GS = GetWorld() ? GetWorld()->GetGameState<AMF_GameState>() : nullptr;
+        Resolved = GS ? GS->GetBallBySlot(ReplicatedState.BallSlot) : nullptr;
+        Resolved = Resolved ? Resolved : Fallback;
+    }
+
+    // Ball slot not resolvable yet: keep the reference until the ball's possessor replicates
+    if (CurrentBall != Resolved && (Resolved || !ReplicatedState.bHasBall))
+    {
+        CurrentBall = Resolved;
+        OnRep_CurrentBall();
+    }
+}
+
 void AMF_PlayerCharacter::OnRep_TeamID()
 {
     UE_LOG(LogTemp, Log, TEXT("MF_PlayerCharacter::OnRep_TeamID - Team: %d"), static_cast<int32>(TeamID));
@@ -633,9 +875,15 @@ void AMF_PlayerCharacter::OnRep_CurrentBall()
 
 void AMF_PlayerCharacter::OnRep_AIProfile()
 {
+    RefreshPlayerRole();
     UpdatePlayerIndicator();
 }
 
+void AMF_PlayerCharacter::RefreshPlayerRole()
+{
+    PlayerRole = MF_Roles::FromProfileName(AIProfile);
+}
+
 bool AMF_PlayerCharacter::CanReceiveBall() const
 {
     // Can receive ball if:
@@ -878,23 +1126,26 @@ void AMF_PlayerCharacter::ExecuteTackle()
 
     static const FName GoalkeeperTag(TEXT("Goalkeeper"));
 
-    for (TActorIterator<AMF_PlayerCharacter> It(GetWorld()); It; ++It)
+    UMF_PlayerSnapshotSubsystem *Snapshots = UMF_PlayerSnapshotSubsystem::Get(this);
+    if (!Snapshots)
     {
-        AMF_PlayerCharacter *Other = *It;
-        if (!Other || Other == this)
-            continue;
-
-        float Distance = FVector::Dist(MyLocation, Other->GetActorLocation());
+        return;
+    }
+    const FMF_PlayerSnapshot &Snapshot = Snapshots->GetSnapshot();
 
-        // Check team - skip teammates (None team can tackle anyone)
-        bool bIsTeammate = (TeamID != EMF_TeamID::None && Other->GetTeamID() == GetTeamID());
+    // Only non-teammates inside the tackle radius are candidates (None team can tackle anyone)
+    const uint8 CandidateMask = (TeamID == EMF_TeamID::None) ? MF_TeamMask::All : MF_TeamMask::AllExcept(TeamID);
+    TArray<int32> Candidates;
+    Snapshot.Grid.QueryRadius(MyLocation, TackleRange, CandidateMask, Candidates, Snapshot.IndexOf(this));
 
-        UE_LOG(LogTemp, Log, TEXT("  Checking %s: Distance=%.1f, HasBall=%d, Team=%d, CurrentBall=%s, IsTeammate=%d"),
-               *Other->GetName(), Distance, Other->HasBall(), (int32)Other->GetTeamID(),
-               Other->CurrentBall ? TEXT("Valid") : TEXT("NULL"), bIsTeammate);
+    for (const int32 Index : Candidates)
+    {
+        AMF_PlayerCharacter *Other = Snapshot.Characters[Index];
+        float Distance = FVector::Dist(MyLocation, Snapshot.Positions[Index]);
 
-        if (bIsTeammate)
-            continue;
+        UE_LOG(LogTemp, Log, TEXT("  Checking %s: Distance=%.1f, HasBall=%d, Team=%d, CurrentBall=%s"),
+               *Other->GetName(), Distance, Snapshot.HasBall[Index], (int32)Snapshot.Teams[Index],
+               Other->CurrentBall ? TEXT("Valid") : TEXT("NULL"));
 
         // Goalkeeper Immunity: Goalkeepers can NEVER be tackled.
         if (Other->ActorHasTag(GoalkeeperTag))
@@ -904,7 +1155,7 @@ void AMF_PlayerCharacter::ExecuteTackle()
         }
 
         // Check if in range and has ball
-        if (Distance <= BestDistance && Other->HasBall() && Other->CurrentBall)
+        if (Distance <= BestDistance && Snapshot.HasBall[Index] && Other->CurrentBall)
         {
             // ==================== FACING CHECK LOGIC ====================
             // Facing check is BYPASSED only for Goalkeepers inside their own penalty area.
@@ -915,14 +1166,9 @@ void AMF_PlayerCharacter::ExecuteTackle()
             // Check if THIS player (the tackler) is a GK inside their own penalty area
             if (ActorHasTag(GoalkeeperTag))
             {
-                // Calculate GK's own penalty box position
-                // TeamA defends at negative Y, TeamB defends at positive Y
-                float MyGoalLineY = (MF_Constants::FieldLength / 2.0f) * ((TeamID == EMF_TeamID::TeamA) ? -1.0f : 1.0f);
-                float MyDistY = FMath::Abs(MyLocation.Y - MyGoalLineY);
-                float MyDistX = FMath::Abs(MyLocation.X);
-                
-                // Penalty Area: 16.5m (1650cm) deep, 40.3m (4030cm) wide → half-width = 2015cm
-                if (MyDistY < MF_Constants::PenaltyAreaLength && MyDistX < (MF_Constants::PenaltyAreaWidth / 2.0f))
+                // GK's own penalty area, from the field's zone map
+                const FMF_FieldLandmarks &Landmarks = UMF_FieldLandmarksSubsystem::GetLandmarks(this);
+                if (EnumHasAnyFlags(Landmarks.GetZones(TeamID, MyLocation), EMF_PitchZone::OwnBox))
                 {
                     bBypassFacingCheck = true;
                     UE_LOG(LogTemp, Log, TEXT("  GK in own penalty box - facing check bypassed"));
@@ -938,7 +1184,7 @@ void AMF_PlayerCharacter::ExecuteTackle()
             else
             {
                 // All other cases: Must be facing the ball carrier
-                FVector ToTarget = (Other->GetActorLocation() - MyLocation).GetSafeNormal();
+                FVector ToTarget = (Snapshot.Positions[Index] - MyLocation).GetSafeNormal();
                 FVector MyForward = GetActorForwardVector();
                 float FacingDot = FVector::DotProduct(MyForward, ToTarget);
                 
@@ -1070,6 +1316,54 @@ void AMF_PlayerCharacter::OnPauseInputReceived()
     }
 }
 
+// ==================== Blackboard Keys ====================
+// Keys written by SyncBlackboard, interned once (distance floats tolerate 1cm of change)
+namespace MF_SyncKeys
+{
+    static const FMF_BlackboardKey MatchIsPlaying(TEXT("MatchIsPlaying"));
+    static const FMF_BlackboardKey HasBall(TEXT("HasBall"));
+    static const FMF_BlackboardKey IsStunned(TEXT("IsStunned"));
+    static const FMF_BlackboardKey IsSprinting(TEXT("IsSprinting"));
+    static const FMF_BlackboardKey MyPosition(TEXT("MyPosition"));
+    static const FMF_BlackboardKey TeamID(TEXT("TeamID"));
+    static const FMF_BlackboardKey IsBallInPlay(TEXT("IsBallInPlay"));
+    static const FMF_BlackboardKey Ball(TEXT("Ball"));
+    static const FMF_BlackboardKey DistToBall(TEXT("DistToBall"), 1.0f); // cm
+    static const FMF_BlackboardKey Goal_Opponent(TEXT("Goal_Opponent"));
+    static const FMF_BlackboardKey DistToOpponentGoal(TEXT("DistToOpponentGoal"), 1.0f); // cm
+    static const FMF_BlackboardKey Home(TEXT("Home"));
+    static const FMF_BlackboardKey DistToHome(TEXT("DistToHome"), 1.0f); // cm
+    static const FMF_BlackboardKey TeamHasBall(TEXT("TeamHasBall"));
+    static const FMF_BlackboardKey OpponentHasBall(TEXT("OpponentHasBall"));
+    static const FMF_BlackboardKey IsBallLoose(TEXT("IsBallLoose"));
+    static const FMF_BlackboardKey DistToNearestOpponent(TEXT("DistToNearestOpponent"), 1.0f); // cm
+    static const FMF_BlackboardKey NearestOpponentPosition(TEXT("NearestOpponentPosition"));
+    static const FMF_BlackboardKey IsInDanger(TEXT("IsInDanger"));
+    static const FMF_BlackboardKey HasStriker(TEXT("HasStriker"));
+    static const FMF_BlackboardKey DistToStriker(TEXT("DistToStriker"), 1.0f); // cm
+    static const FMF_BlackboardKey StrikerPosition(TEXT("StrikerPosition"));
+    static const FMF_BlackboardKey HasClearShot(TEXT("HasClearShot"));
+    static const FMF_BlackboardKey AmIClosestToBall(TEXT("AmIClosestToBall"));
+    static const FMF_BlackboardKey AmISecondClosestToBall(TEXT("AmISecondClosestToBall"));
+    static const FMF_BlackboardKey BallChaseRank(TEXT("BallChaseRank"));
+    static const FMF_BlackboardKey TimeToBall(TEXT("TimeToBall"));
+    static const FMF_BlackboardKey SupportPosition(TEXT("SupportPosition"));
+    static const FMF_BlackboardKey DistToSupportPosition(TEXT("DistToSupportPosition"), 1.0f); // cm
+    static const FMF_BlackboardKey HasOpenSpace(TEXT("HasOpenSpace"));
+    static const FMF_BlackboardKey OpenSpacePosition(TEXT("OpenSpacePosition"));
+    static const FMF_BlackboardKey InOwnBox(TEXT("InOwnBox"));
+    static const FMF_BlackboardKey InOpponentBox(TEXT("InOpponentBox"));
+    static const FMF_BlackboardKey InDefensiveThird(TEXT("InDefensiveThird"));
+    static const FMF_BlackboardKey InAttackingThird(TEXT("InAttackingThird"));
+    static const FMF_BlackboardKey OnFlank(TEXT("OnFlank"));
+    static const FMF_BlackboardKey BallInOwnBox(TEXT("BallInOwnBox"));
+    static const FMF_BlackboardKey BallInOpponentBox(TEXT("BallInOpponentBox"));
+    static const FMF_BlackboardKey BallInDefensiveThird(TEXT("BallInDefensiveThird"));
+    static const FMF_BlackboardKey BallInAttackingThird(TEXT("BallInAttackingThird"));
+    static const FMF_BlackboardKey GK_TargetPosition(TEXT("GK_TargetPosition"));
+    static const FMF_BlackboardKey Role(TEXT("Role"));
+}
+
 // ==================== AI Implementation ====================
 
 void AMF_PlayerCharacter::StartAI()
@@ -1077,6 +1371,8 @@ void AMF_PlayerCharacter::StartAI()
     if (AIComponent)
     {
         AIComponent->StartAI();
+        BlackboardWriter.Invalidate();
+        RegisterWithAISyncScheduler();
 
         if (bDebugAI)
         {
@@ -1159,9 +1455,45 @@ bool AMF_PlayerCharacter::EAIS_GetTargetLocation_Implementation(FName TargetId,
 }
 
 bool AMF_PlayerCharacter::EAIS_GetTargetActor_Implementation(FName TargetId, AActor *&OutActor) const
+{
+    const EMF_TargetID Id = MF_Targets::FromName(TargetId);
+    if (Id == EMF_TargetID::Unknown)
+    {
+        return false;
+    }
+
+    UMF_PlayerSnapshotSubsystem *Snapshots = UMF_PlayerSnapshotSubsystem::Get(this);
+    if (!Snapshots)
+    {
+        return false;
+    }
 
+    // Resolved once per frame; possession/team changes invalidate via the snapshot generation
+    const uint64 Generation = Snapshots->GetGeneration();
+    bool bFound = false;
+    if (TargetCache.Lookup(Id, Generation, OutActor, bFound))
+    {
+        return bFound;
+    }
+
+    AActor *Resolved = nullptr;
+    bFound = ResolveTargetActor(Id, Snapshots->GetSnapshot(), Resolved);
+    TargetCache.Store(Id, Generation, Resolved, bFound);
+
+    if (bFound)
+    {
+        OutActor = Resolved;
+    }
+    return bFound;
+}
+
+bool AMF_PlayerCharacter::ResolveTargetActor(EMF_TargetID Id, const FMF_PlayerSnapshot &Snapshot, AActor *&OutActor) const
 {
-    if (TargetId == "Ball")
+    const int32 MyIndex = Snapshot.IndexOf(this);
+
+    switch (Id)
+    {
+    case EMF_TargetID::Ball:
     {
         if (CurrentBall)
         {
@@ -1169,141 +1501,99 @@ bool AMF_PlayerCharacter::EAIS_GetTargetActor_Implementation(FName TargetId, AAc
             return true;
         }
 
-        // Find ball in world
-        for (TActorIterator<AMF_Ball> It(GetWorld()); It; ++It)
+        if (Snapshot.Ball)
         {
-            OutActor = *It;
+            OutActor = Snapshot.Ball;
             return true;
         }
+        return false;
     }
 
-    if (TargetId == "Goal_Opponent" || TargetId == "Goal_Self")
+    case EMF_TargetID::Goal_Opponent:
+    case EMF_TargetID::Goal_Self:
     {
-        bool bOpponent = (TargetId == "Goal_Opponent");
-        for (TActorIterator<AMF_Goal> It(GetWorld()); It; ++It)
+        // Goals are indexed by the team that DEFENDS them.
+        // So if I'm TeamA, Goal_Opponent is the one TeamB defends (where TeamA scores).
+        const UMF_FieldLandmarksSubsystem *Landmarks = UMF_FieldLandmarksSubsystem::Get(this);
+        if (!Landmarks || TeamID == EMF_TeamID::None)
         {
-            AMF_Goal *Goal = *It;
-            // GoalTeam is the team that scores.
-            // So if I'm TeamA, Goal_Opponent is the one where TeamA scores.
-            if (bOpponent)
-            {
-                if (Goal->DefendingTeam != TeamID && Goal->DefendingTeam != EMF_TeamID::None)
-                {
-                    OutActor = Goal;
-                    return true;
-                }
-            }
-            else
-            {
-                if (Goal->DefendingTeam == TeamID)
-                {
-                    OutActor = Goal;
-                    return true;
-                }
-            }
+            return false;
         }
+
+        const EMF_TeamID DefendingTeam = (Id == EMF_TargetID::Goal_Opponent) ? FMF_FieldLandmarks::Opponent(TeamID) : TeamID;
+        OutActor = Landmarks->GetGoal(DefendingTeam);
+        return OutActor != nullptr;
     }
 
-    if (TargetId == "BallCarrier")
+    case EMF_TargetID::BallCarrier:
     {
-        for (TActorIterator<AMF_PlayerCharacter> It(GetWorld()); It; ++It)
+        if (Snapshot.CarrierIndex != INDEX_NONE)
         {
-            if (It->HasBall())
-            {
-                OutActor = *It;
-                return true;
-            }
+            OutActor = Snapshot.Characters[Snapshot.CarrierIndex];
+            return true;
         }
+        return false;
     }
 
-    if (TargetId == "NearestOpponent")
+    case EMF_TargetID::NearestOpponent:
     {
-        float NearestDist = 99999.0f;
-        AMF_PlayerCharacter *Nearest = nullptr;
-
-        for (TActorIterator<AMF_PlayerCharacter> It(GetWorld()); It; ++It)
-        {
-            AMF_PlayerCharacter *Other = *It;
-            if (Other && Other != this && Other->GetTeamID() != TeamID)
-            {
-                const float Dist = FVector::Dist(GetActorLocation(), Other->GetActorLocation());
-                if (Dist < NearestDist)
-                {
-                    NearestDist = Dist;
-                    Nearest = Other;
-                }
-            }
-        }
-
-        if (Nearest)
+        const int32 NearestIndex = Snapshot.Grid.FindNearest(GetActorLocation(), MF_TeamMask::AllExcept(TeamID), MyIndex, 99999.0f);
+        if (NearestIndex != INDEX_NONE)
         {
-            OutActor = Nearest;
+            OutActor = Snapshot.Characters[NearestIndex];
             return true;
         }
+        return false;
     }
 
-    if (TargetId == "Striker")
+    case EMF_TargetID::Striker:
+    case EMF_TargetID::Midfielder:
     {
-        // Find a teammate with the Striker role
+        // Find the nearest teammate with the requested role
+        const EMF_PlayerRole WantedRole = (Id == EMF_TargetID::Striker) ? EMF_PlayerRole::Striker : EMF_PlayerRole::Midfielder;
+        const FVector MyLocation = GetActorLocation();
         float NearestDist = 99999.0f;
-        AMF_PlayerCharacter* BestStriker = nullptr;
+        AMF_PlayerCharacter *BestTeammate = nullptr;
 
-        for (TActorIterator<AMF_PlayerCharacter> It(GetWorld()); It; ++It)
+        for (int32 Index = 0; Index < Snapshot.Num(); ++Index)
         {
-            AMF_PlayerCharacter* Teammate = *It;
-            if (Teammate && Teammate != this && Teammate->GetTeamID() == TeamID)
+            if (Index == MyIndex || Snapshot.Teams[Index] != TeamID || Snapshot.Roles[Index] != WantedRole)
             {
-                // Check if profile name contains "Striker"
-                if (Teammate->AIProfile.Contains(TEXT("Striker")))
-                {
-                     const float Dist = FVector::Dist(GetActorLocation(), Teammate->GetActorLocation());
-                     if (Dist < NearestDist)
-                     {
-                         NearestDist = Dist;
-                         BestStriker = Teammate;
-                     }
-                }
+                continue;
             }
-        }
-
-        if (BestStriker)
-        {
-            OutActor = BestStriker;
-            return true;
-        }
-    }
-
-    if (TargetId == "Midfielder")
-    {
-        // Find a teammate with the Midfielder role
-        float NearestDist = 99999.0f;
-        AMF_PlayerCharacter* BestMid = nullptr;
 
-        for (TActorIterator<AMF_PlayerCharacter> It(GetWorld()); It; ++It)
-        {
-            AMF_PlayerCharacter* Teammate = *It;
-            if (Teammate && Teammate != this && Teammate->GetTeamID() == TeamID)
+            const float Dist = FVector::Dist(MyLocation, Snapshot.Positions[Index]);
+            if (Dist < NearestDist)
             {
-                if (Teammate->AIProfile.Contains(TEXT("Midfielder")))
-                {
-                     const float Dist = FVector::Dist(GetActorLocation(), Teammate->GetActorLocation());
-                     if (Dist < NearestDist)
-                     {
-                         NearestDist = Dist;
-                         BestMid = Teammate;
-                     }
-                }
+                NearestDist = Dist;
+                BestTeammate = Snapshot.Characters[Index];
             }
         }
 
-        if (BestMid)
+        if (BestTeammate)
         {
-            OutActor = BestMid;
+            OutActor = BestTeammate;
             return true;
         }
+        return false;
     }
 
-    return false;
+    default:
+        return false;
+    }
+}
+
+void AMF_PlayerCharacter::RegisterWithAISyncScheduler()
+{
+    if (!HasAuthority())
+    {
+        return;
+    }
+
+    if (UMF_AISyncScheduler *Scheduler = UMF_AISyncScheduler::Get(this))
+    {
+        Scheduler->RegisterAgent(this);
+    }
 }
 
 void AMF_PlayerCharacter::StopAI()
@@ -1319,6 +1609,7 @@ void AMF_PlayerCharacter::ResetAI()
     if (AIComponent)
     {
         AIComponent->ResetAI();
+        BlackboardWriter.Invalidate();
     }
 }
 
@@ -1347,13 +1638,17 @@ bool AMF_PlayerCharacter::SetAIProfile(const FString &ProfileName)
 
     AIComponent->JsonFilePath = ProfilePath;
     AIComponent->ResetAI();
+    BlackboardWriter.Invalidate();
 
     AIProfile = ProfileName;
+    RefreshPlayerRole();
+    PublishReplicatedState();
 
     // Restart if was running (using the directory!)
     if (bAutoStartAI)
     {
         AIComponent->StartAI(AIProfile, AIProfileDir);
+        RegisterWithAISyncScheduler();
     }
 
     return true;
@@ -1388,316 +1683,274 @@ void AMF_PlayerCharacter::SyncBlackboard()
         return;
     }
 
-    const FVector MyLocation = GetActorLocation();
-
-    // ==================== MATCH PHASE AWARENESS ====================
-    bool bMatchIsPlaying = false;
-    if (const AMF_GameState* GS = GetWorld()->GetGameState<AMF_GameState>())
+    UMF_PlayerSnapshotSubsystem *Snapshots = UMF_PlayerSnapshotSubsystem::Get(this);
+    if (!Snapshots)
     {
-        bMatchIsPlaying = (GS->CurrentPhase == EMF_MatchPhase::Playing);
+        return;
     }
-    AIComponent->SetBlackboardBool(TEXT("MatchIsPlaying"), bMatchIsPlaying);
 
-    // ==================== BASIC STATE ====================
-    AIComponent->SetBlackboardBool(TEXT("HasBall"), HasBall());
-    AIComponent->SetBlackboardBool(TEXT("IsStunned"), IsStunned());
-    AIComponent->SetBlackboardBool(TEXT("IsSprinting"), bIsSprinting);
-    AIComponent->SetBlackboardVector(TEXT("MyPosition"), MyLocation);
-    AIComponent->SetBlackboardFloat(TEXT("TeamID"), static_cast<float>(GetTeamID()));
+    // All per-player reads below come from the shared per-frame snapshot
+    const FMF_PlayerSnapshot &Snapshot = Snapshots->GetSnapshot();
+
+    FMF_AgentPerceptionInput Input;
+    GatherPerceptionInput(Snapshot, Input);
 
-    // Log sync occasionally
-    static float LastSyncLogTime = 0.0f;
-    if (GetWorld()->GetTimeSeconds() - LastSyncLogTime > 2.0f)
+    FMF_AgentPerception Perception;
+    ComputePerception(Snapshot, Input, Perception);
+
+    ApplyPerception(Snapshot, Input, Perception);
+}
+
+void AMF_PlayerCharacter::GatherPerceptionInput(const FMF_PlayerSnapshot &Snapshot, FMF_AgentPerceptionInput &OutInput) const
+{
+    OutInput.MyIndex = Snapshot.IndexOf(this);
+    OutInput.MyLocation = GetActorLocation();
+
+    // Ball: target provider first, snapshot ball as fallback
+    OutInput.bBallFound = IEAIS_TargetProvider::Execute_EAIS_GetTargetLocation(this, TEXT("Ball"), OutInput.BallPos);
+    if (!OutInput.bBallFound && Snapshot.Ball)
     {
-        //UE_LOG(LogTemp, Log, TEXT("MF_PlayerCharacter[%s]::Sync - HasBall: %d, Pos: %s"), *GetName(), HasBall(), *MyLocation.ToString());
-        LastSyncLogTime = GetWorld()->GetTimeSeconds();
+        OutInput.BallPos = Snapshot.BallLocation;
+        OutInput.bBallFound = true;
     }
 
-    // ==================== BALL DATA ====================
-    FVector BallPos = FVector::ZeroVector;
-    AMF_Ball *MatchBall = nullptr;
-    bool bBallFound = false;
-    bool bIsBallOutOfBounds = false;
+    OutInput.bGoalFound = IEAIS_TargetProvider::Execute_EAIS_GetTargetLocation(this, TEXT("Goal_Opponent"), OutInput.GoalPos);
+    if (!OutInput.bGoalFound)
+    {
+        OutInput.GoalPos = FVector::ZeroVector;
+    }
+
+    OutInput.PitchControl = UMF_PitchControlSubsystem::Get(this);
+    OutInput.Landmarks = &UMF_FieldLandmarksSubsystem::GetLandmarks(this);
+}
+
+void AMF_PlayerCharacter::ComputePerception(const FMF_PlayerSnapshot &Snapshot, const FMF_AgentPerceptionInput &Input, FMF_AgentPerception &OutPerception) const
+{
+    const int32 MyIndex = Input.MyIndex;
+    const FVector &MyLocation = Input.MyLocation;
+    const FMF_FieldLandmarks &Landmarks = *Input.Landmarks;
+
+    // ==================== PITCH ZONES ====================
+    OutPerception.MyZones = Landmarks.GetZones(TeamID, MyLocation);
+    OutPerception.BallZones = Input.bBallFound ? Landmarks.GetZones(TeamID, Input.BallPos) : EMF_PitchZone::None;
+
+    // ==================== NEAREST OPPONENT ====================
+    OutPerception.NearestOpponentIndex = Snapshot.Grid.FindNearest(MyLocation, MF_TeamMask::AllExcept(TeamID), MyIndex,
+                                                                   OutPerception.NearestOpponentDist, &OutPerception.NearestOpponentDist);
 
-    // First check via target provider
-    if (IEAIS_TargetProvider::Execute_EAIS_GetTargetLocation(this, TEXT("Ball"), BallPos))
+    // ==================== STRIKER TARGETING ====================
+    // Used by Midfielder AI to decide when a striker pass is viable.
+    for (int32 Index = 0; Index < Snapshot.Num(); ++Index)
     {
-        bBallFound = true;
+        if (Index == MyIndex || Snapshot.Teams[Index] != TeamID)
+        {
+            continue;
+        }
+
+        if (Snapshot.Roles[Index] != EMF_PlayerRole::Striker)
+        {
+            continue;
+        }
+
+        const float Dist = FVector::Dist(MyLocation, Snapshot.Positions[Index]);
+        if (Dist < OutPerception.DistToStriker)
+        {
+            OutPerception.DistToStriker = Dist;
+            OutPerception.StrikerPos = Snapshot.Positions[Index];
+            OutPerception.bHasStriker = true;
+        }
     }
 
-    // Get ball actor for possession check
-    for (TActorIterator<AMF_Ball> It(GetWorld()); It; ++It)
+    // ==================== CLEAR SHOT CHECK ====================
+    // HasClearShot: True if no enemies are directly between player and goal
+    const bool bIAmCarrier = MyIndex != INDEX_NONE && Snapshot.HasBall[MyIndex];
+    if (bIAmCarrier && Input.GoalPos != FVector::ZeroVector)
     {
-        AMF_Ball* Ball = *It;
-        if (Ball)
+        // Blocked if any enemy between us and the goal is within the ~30 degree shot cone
+        FMF_LaneOpponents Opponents;
+        Opponents.AddFromSnapshot(Snapshot, MF_TeamMask::AllExcept(TeamID), MyIndex);
+
+        const FMF_LaneClearance ShotLane = MF_LaneClearance::EvaluateLane(MyLocation, Input.GoalPos, Opponents);
+        OutPerception.bHasClearShot = !ShotLane.IsBlocked(MF_LaneCone::Shot);
+    }
+
+    // ==================== SUPPORT POSITION ====================
+    // Calculate intelligent support position based on ball and role
+    const bool bMyTeamHasBall = Snapshot.CarrierIndex != INDEX_NONE && Snapshot.Teams[Snapshot.CarrierIndex] == TeamID;
+    OutPerception.SupportPosition = CalculateSupportPosition(Landmarks, Input.BallPos, TeamID, bMyTeamHasBall);
+
+    // ==================== OPEN SPACE ====================
+    // Attacking off the ball: move the role's support spot to the nearby cell our team controls best
+    if (bMyTeamHasBall && !bIAmCarrier && PlayerRole != EMF_PlayerRole::Goalkeeper && Input.PitchControl)
+    {
+        constexpr float OpenSpaceSearchRadius = 800.0f; // 8 meters around the role's support spot
+        OutPerception.bHasOpenSpace = Input.PitchControl->FindBestOpenSpace(TeamID, OutPerception.SupportPosition, OpenSpaceSearchRadius,
+                                                                            OutPerception.OpenSpacePosition);
+        if (OutPerception.bHasOpenSpace)
         {
-            MatchBall = Ball;
-            if (!bBallFound)
-            {
-                BallPos = Ball->GetActorLocation();
-                bBallFound = true;
-            }
-            bIsBallOutOfBounds = Ball->IsOutOfBounds();
-            break;
+            OutPerception.SupportPosition = OutPerception.OpenSpacePosition;
         }
     }
+}
 
-    AIComponent->SetBlackboardBool(TEXT("IsBallInPlay"), bBallFound && !bIsBallOutOfBounds && bMatchIsPlaying);
+void AMF_PlayerCharacter::ApplyPerception(const FMF_PlayerSnapshot &Snapshot, const FMF_AgentPerceptionInput &Input, const FMF_AgentPerception &Perception)
+{
+    if (!AIComponent)
+    {
+        return;
+    }
+
+    const FVector &MyLocation = Input.MyLocation;
 
-    if (bBallFound)
+    // ==================== MATCH PHASE AWARENESS ====================
+    bool bMatchIsPlaying = false;
+    if (const AMF_GameState* GS = GetWorld()->GetGameState<AMF_GameState>())
     {
-        AIComponent->SetBlackboardVector(TEXT("Ball"), BallPos);
-        const float DistToBall = FVector::Dist(MyLocation, BallPos);
-        AIComponent->SetBlackboardFloat(TEXT("DistToBall"), DistToBall);
+        bMatchIsPlaying = (GS->CurrentPhase == EMF_MatchPhase::Playing);
     }
-    else
+    BlackboardWriter.SetBool(MF_SyncKeys::MatchIsPlaying, bMatchIsPlaying);
+
+    // ==================== BASIC STATE ====================
+    BlackboardWriter.SetBool(MF_SyncKeys::HasBall, HasBall());
+    BlackboardWriter.SetBool(MF_SyncKeys::IsStunned, IsStunned());
+    BlackboardWriter.SetBool(MF_SyncKeys::IsSprinting, bIsSprinting);
+    BlackboardWriter.SetVector(MF_SyncKeys::MyPosition, MyLocation);
+    BlackboardWriter.SetFloat(MF_SyncKeys::TeamID, static_cast<float>(GetTeamID()));
+
+    // ==================== BALL DATA ====================
+    const bool bIsBallOutOfBounds = Snapshot.Ball && Snapshot.Ball->IsOutOfBounds();
+    BlackboardWriter.SetBool(MF_SyncKeys::IsBallInPlay, Input.bBallFound && !bIsBallOutOfBounds && bMatchIsPlaying);
+
+    if (Input.bBallFound)
     {
-        AIComponent->SetBlackboardFloat(TEXT("DistToBall"), 99999.0f);
+        BlackboardWriter.SetVector(MF_SyncKeys::Ball, Input.BallPos);
     }
 
     // ==================== GOAL DATA ====================
-    FVector GoalPos = FVector::ZeroVector;
-    if (IEAIS_TargetProvider::Execute_EAIS_GetTargetLocation(this, TEXT("Goal_Opponent"), GoalPos))
+    if (Input.bGoalFound)
     {
-        AIComponent->SetBlackboardVector(TEXT("Goal_Opponent"), GoalPos);
-        const float DistToGoal = FVector::Dist(MyLocation, GoalPos);
-        AIComponent->SetBlackboardFloat(TEXT("DistToOpponentGoal"), DistToGoal);
+        BlackboardWriter.SetVector(MF_SyncKeys::Goal_Opponent, Input.GoalPos);
+        BlackboardWriter.SetFloat(MF_SyncKeys::DistToOpponentGoal, FVector::Dist(MyLocation, Input.GoalPos));
     }
     else
     {
-        AIComponent->SetBlackboardFloat(TEXT("DistToOpponentGoal"), 99999.0f);
+        BlackboardWriter.SetFloat(MF_SyncKeys::DistToOpponentGoal, 99999.0f);
     }
 
-    // ==================== HOME/FORMATION DATA ====================
-    // TODO: Get actual formation position from GameState
-    const FVector HomePos = GetActorLocation(); // Placeholder
-    AIComponent->SetBlackboardVector(TEXT("Home"), HomePos);
-    AIComponent->SetBlackboardFloat(TEXT("DistToHome"), 0.0f); // Will be actual distance when formation implemented
-
     // ==================== POSSESSION STATE ====================
     bool bTeamHasBall = false;
     bool bOpponentHasBall = false;
     bool bBallLoose = true;
-    AMF_PlayerCharacter *BallCarrier = nullptr;
 
-    // Check all players for ball possession
-    for (TActorIterator<AMF_PlayerCharacter> It(GetWorld()); It; ++It)
+    if (Snapshot.CarrierIndex != INDEX_NONE)
     {
-        AMF_PlayerCharacter *OtherPlayer = *It;
-        if (OtherPlayer && OtherPlayer->HasBall())
-        {
-            bBallLoose = false;
-            BallCarrier = OtherPlayer;
+        bBallLoose = false;
 
-            if (OtherPlayer->GetTeamID() == TeamID)
-            {
-                bTeamHasBall = true;
-            }
-            else
-            {
-                bOpponentHasBall = true;
-            }
-            break;
+        if (Snapshot.Teams[Snapshot.CarrierIndex] == TeamID)
+        {
+            bTeamHasBall = true;
         }
-    }
-
-    AIComponent->SetBlackboardBool(TEXT("TeamHasBall"), bTeamHasBall);
-    AIComponent->SetBlackboardBool(TEXT("OpponentHasBall"), bOpponentHasBall);
-    AIComponent->SetBlackboardBool(TEXT("IsBallLoose"), bBallLoose);
-
-    // ==================== NEAREST OPPONENT ====================
-    float NearestOpponentDist = 99999.0f;
-    AMF_PlayerCharacter *NearestOpponent = nullptr;
-
-    for (TActorIterator<AMF_PlayerCharacter> It(GetWorld()); It; ++It)
-    {
-        AMF_PlayerCharacter *OtherPlayer = *It;
-        if (OtherPlayer && OtherPlayer != this && OtherPlayer->GetTeamID() != TeamID)
+        else
         {
-            const float Dist = FVector::Dist(MyLocation, OtherPlayer->GetActorLocation());
-            if (Dist < NearestOpponentDist)
-            {
-                NearestOpponentDist = Dist;
-                NearestOpponent = OtherPlayer;
-            }
+            bOpponentHasBall = true;
         }
     }
 
-    AIComponent->SetBlackboardFloat(TEXT("DistToNearestOpponent"), NearestOpponentDist);
-    if (NearestOpponent)
+    BlackboardWriter.SetBool(MF_SyncKeys::TeamHasBall, bTeamHasBall);
+    BlackboardWriter.SetBool(MF_SyncKeys::OpponentHasBall, bOpponentHasBall);
+    BlackboardWriter.SetBool(MF_SyncKeys::IsBallLoose, bBallLoose);
+
+    // ==================== NEAREST OPPONENT ====================
+    BlackboardWriter.SetFloat(MF_SyncKeys::DistToNearestOpponent, Perception.NearestOpponentDist);
+    if (Perception.NearestOpponentIndex != INDEX_NONE)
     {
-        AIComponent->SetBlackboardVector(TEXT("NearestOpponentPosition"), NearestOpponent->GetActorLocation());
+        BlackboardWriter.SetVector(MF_SyncKeys::NearestOpponentPosition, Snapshot.Positions[Perception.NearestOpponentIndex]);
     }
 
     // ==================== DANGER DETECTION ====================
     // IsInDanger: True if opponent is within tackle range (~200 units)
     constexpr float DangerRadius = 200.0f;
-    const bool bIsInDanger = NearestOpponentDist < DangerRadius;
-    AIComponent->SetBlackboardBool(TEXT("IsInDanger"), bIsInDanger);
+    const bool bIsInDanger = Perception.NearestOpponentDist < DangerRadius;
+    BlackboardWriter.SetBool(MF_SyncKeys::IsInDanger, bIsInDanger);
 
     // ==================== STRIKER TARGETING ====================
-    // Used by Midfielder AI to decide when a striker pass is viable.
-    bool bHasStriker = false;
-    float DistToStriker = 99999.0f;
-    FVector StrikerPos = FVector::ZeroVector;
-
-    for (TActorIterator<AMF_PlayerCharacter> It(GetWorld()); It; ++It)
+    BlackboardWriter.SetBool(MF_SyncKeys::HasStriker, Perception.bHasStriker);
+    BlackboardWriter.SetFloat(MF_SyncKeys::DistToStriker, Perception.DistToStriker);
+    if (Perception.bHasStriker)
     {
-        AMF_PlayerCharacter* Teammate = *It;
-        if (!Teammate || Teammate == this || Teammate->GetTeamID() != TeamID)
-        {
-            continue;
-        }
-
-        if (!Teammate->AIProfile.Contains(TEXT("Striker")))
-        {
-            continue;
-        }
-
-        const float Dist = FVector::Dist(MyLocation, Teammate->GetActorLocation());
-        if (Dist < DistToStriker)
-        {
-            DistToStriker = Dist;
-            StrikerPos = Teammate->GetActorLocation();
-            bHasStriker = true;
-        }
-    }
-
-    AIComponent->SetBlackboardBool(TEXT("HasStriker"), bHasStriker);
-    AIComponent->SetBlackboardFloat(TEXT("DistToStriker"), DistToStriker);
-    if (bHasStriker)
-    {
-        AIComponent->SetBlackboardVector(TEXT("StrikerPosition"), StrikerPos);
+        BlackboardWriter.SetVector(MF_SyncKeys::StrikerPosition, Perception.StrikerPos);
     }
 
     // ==================== CLEAR SHOT CHECK ====================
-    // HasClearShot: True if no enemies are directly between player and goal
-    bool bHasClearShot = false;
-    if (HasBall() && GoalPos != FVector::ZeroVector)
-    {
-        bHasClearShot = true; // Assume clear by default
-
-        const FVector ToGoal = (GoalPos - MyLocation).GetSafeNormal();
-        const float GoalDist = FVector::Dist(MyLocation, GoalPos);
-
-        for (TActorIterator<AMF_PlayerCharacter> It(GetWorld()); It; ++It)
-        {
-            AMF_PlayerCharacter *OtherPlayer = *It;
-            if (OtherPlayer && OtherPlayer != this && OtherPlayer->GetTeamID() != TeamID)
-            {
-                const FVector ToEnemy = OtherPlayer->GetActorLocation() - MyLocation;
-                const float EnemyDist = ToEnemy.Size();
-
-                // Only check enemies between us and the goal
-                if (EnemyDist < GoalDist)
-                {
-                    // Check if enemy is in the "cone" towards the goal
-                    const float DotProduct = FVector::DotProduct(ToGoal, ToEnemy.GetSafeNormal());
-                    if (DotProduct > 0.85f) // Within ~30 degree cone
-                    {
-                        bHasClearShot = false;
-                        break;
-                    }
-                }
-            }
-        }
-    }
-    AIComponent->SetBlackboardBool(TEXT("HasClearShot"), bHasClearShot);
+    BlackboardWriter.SetBool(MF_SyncKeys::HasClearShot, Perception.bHasClearShot);
 
     // ==================== CLOSEST TO BALL DETECTION (CRITICAL FIX) ====================
-    // Only the closest teammate to the ball should chase it - prevents all AI mobbing the ball
+    // Only the closest teammate to the ball should chase it - prevents all AI mobbing the ball.
+    // The team ranking (role-weighted time-to-ball) is computed once per frame in the snapshot.
     bool bAmIClosestToBall = true; // Assume true until proven otherwise
     float MyDistToBall = 99999.0f;
+    int32 MyChaseRank = 0;
+    float MyTimeToBall = 99999.0f;
 
-    if (bBallFound)
+    if (Input.bBallFound)
     {
-        // Calculate My Effective Distance
-        float MyEffectiveDist = FVector::Dist(MyLocation, BallPos);
-        
-        // PRIORITY ADJUSTMENTS:
-        // Strikers are "closer" by virtue of role (more aggressive)
-        if (AIProfile.Contains(TEXT("Striker")))
-        {
-            MyEffectiveDist *= 0.85f; // 15% bonus
-        }
-        else if (AIProfile.Contains(TEXT("Goalkeeper")))
-        {
-            // If ball is in penalty box, GK is HYPER aggressive
-            // Penalty box is ~16m (1650 units) deep
-            float GoalLineY = (MF_Constants::FieldLength / 2.0f) * ((TeamID == EMF_TeamID::TeamA) ? -1.0f : 1.0f);
-            if (FMath::Abs(BallPos.Y - GoalLineY) < 1650.0f && FMath::Abs(BallPos.X) < 2015.0f)
-            {
-                 MyEffectiveDist *= 0.1f; // Massive priority
-            }
-            else
-            {
-                 MyEffectiveDist *= 2.0f; // Stay in goal otherwise
-            }
-        }
-        
-        MyDistToBall = FVector::Dist(MyLocation, BallPos); // Actual distance for blackboard
-        
-        // Check teammates
-        for (TActorIterator<AMF_PlayerCharacter> ClosestIt(GetWorld()); ClosestIt; ++ClosestIt)
-        {
-            AMF_PlayerCharacter* OtherPlayer = *ClosestIt;
-            if (!OtherPlayer || OtherPlayer == this || OtherPlayer->GetTeamID() != TeamID)
-                continue;
+        MyDistToBall = FVector::Dist(MyLocation, Input.BallPos); // Actual distance for blackboard
 
-            float TheirEffectiveDist = FVector::Dist(OtherPlayer->GetActorLocation(), BallPos);
-            
-            // Apply same weighting logic to teammates
-            if (OtherPlayer->AIProfile.Contains(TEXT("Striker")))
-            {
-                TheirEffectiveDist *= 0.85f;
-            }
-            else if (OtherPlayer->AIProfile.Contains(TEXT("Goalkeeper")))
-            {
-                 float GoalLineY = (MF_Constants::FieldLength / 2.0f) * ((TeamID == EMF_TeamID::TeamA) ? -1.0f : 1.0f);
-                 if (FMath::Abs(BallPos.Y - GoalLineY) < 1650.0f && FMath::Abs(BallPos.X) < 2015.0f)
-                 {
-                      TheirEffectiveDist *= 0.1f;
-                 }
-                 else
-                 {
-                      TheirEffectiveDist *= 2.0f;
-                 }
-            }
+        if (Input.MyIndex != INDEX_NONE && Snapshot.Ball)
+        {
+            MyChaseRank = Snapshot.BallChaseRanks[Input.MyIndex];
+            MyTimeToBall = Snapshot.BallChaseTimes[Input.MyIndex];
 
-            if (TheirEffectiveDist < MyEffectiveDist - 50.0f) 
-            {
-                bAmIClosestToBall = false;
-                break;
-            }
+            const int32 LeadChaser = Snapshot.GetChaser(TeamID, 0);
+            bAmIClosestToBall = (LeadChaser == INDEX_NONE) ||
+                                (MyTimeToBall <= Snapshot.BallChaseTimes[LeadChaser] + FMF_PlayerSnapshot::ChaseTieMargin);
         }
     }
 
-    AIComponent->SetBlackboardBool(TEXT("AmIClosestToBall"), bAmIClosestToBall);
-    AIComponent->SetBlackboardFloat(TEXT("DistToBall"), MyDistToBall);
+    BlackboardWriter.SetBool(MF_SyncKeys::AmIClosestToBall, bAmIClosestToBall);
+    BlackboardWriter.SetBool(MF_SyncKeys::AmISecondClosestToBall, Input.bBallFound && MyChaseRank == 1);
+    BlackboardWriter.SetFloat(MF_SyncKeys::BallChaseRank, static_cast<float>(MyChaseRank));
+    BlackboardWriter.SetFloat(MF_SyncKeys::TimeToBall, MyTimeToBall);
+    BlackboardWriter.SetFloat(MF_SyncKeys::DistToBall, MyDistToBall);
 
     // ==================== ROLE-BASED DATA ====================
-    AIComponent->SetBlackboardValue(TEXT("Role"), FBlackboardValue(FString(AIProfile)));
+    BlackboardWriter.SetString(MF_SyncKeys::Role, AIProfile);
 
     // ==================== FORMATION POSITION ====================
     // Use stored spawn position as home position for formation-based AI
-    AIComponent->SetBlackboardVector(TEXT("Home"), SpawnLocation);
+    BlackboardWriter.SetVector(MF_SyncKeys::Home, SpawnLocation);
     const float DistToHome = FVector::Dist(MyLocation, SpawnLocation);
-    AIComponent->SetBlackboardFloat(TEXT("DistToHome"), DistToHome);
+    BlackboardWriter.SetFloat(MF_SyncKeys::DistToHome, DistToHome);
 
     // ==================== SUPPORT POSITION ====================
-    // Calculate intelligent support position based on ball and role
-    const FVector SupportPos = CalculateSupportPosition(BallPos, TeamID);
-    AIComponent->SetBlackboardVector(TEXT("SupportPosition"), SupportPos);
-    
+    BlackboardWriter.SetVector(MF_SyncKeys::SupportPosition, Perception.SupportPosition);
+
     // Add distance for logic checks
-    const float DistToSupport = FVector::Dist(MyLocation, SupportPos);
-    AIComponent->SetBlackboardFloat(TEXT("DistToSupportPosition"), DistToSupport);
+    const float DistToSupport = FVector::Dist(MyLocation, Perception.SupportPosition);
+    BlackboardWriter.SetFloat(MF_SyncKeys::DistToSupportPosition, DistToSupport);
+
+    BlackboardWriter.SetBool(MF_SyncKeys::HasOpenSpace, Perception.bHasOpenSpace);
+    if (Perception.bHasOpenSpace)
+    {
+        BlackboardWriter.SetVector(MF_SyncKeys::OpenSpacePosition, Perception.OpenSpacePosition);
+    }
+
+    // ==================== PITCH ZONES ====================
+    BlackboardWriter.SetBool(MF_SyncKeys::InOwnBox, EnumHasAnyFlags(Perception.MyZones, EMF_PitchZone::OwnBox));
+    BlackboardWriter.SetBool(MF_SyncKeys::InOpponentBox, EnumHasAnyFlags(Perception.MyZones, EMF_PitchZone::OpponentBox));
+    BlackboardWriter.SetBool(MF_SyncKeys::InDefensiveThird, EnumHasAnyFlags(Perception.MyZones, EMF_PitchZone::DefensiveThird));
+    BlackboardWriter.SetBool(MF_SyncKeys::InAttackingThird, EnumHasAnyFlags(Perception.MyZones, EMF_PitchZone::AttackingThird));
+    BlackboardWriter.SetBool(MF_SyncKeys::OnFlank, EnumHasAnyFlags(Perception.MyZones, EMF_PitchZone::Flank));
+    BlackboardWriter.SetBool(MF_SyncKeys::BallInOwnBox, EnumHasAnyFlags(Perception.BallZones, EMF_PitchZone::OwnBox));
+    BlackboardWriter.SetBool(MF_SyncKeys::BallInOpponentBox, EnumHasAnyFlags(Perception.BallZones, EMF_PitchZone::OpponentBox));
+    BlackboardWriter.SetBool(MF_SyncKeys::BallInDefensiveThird, EnumHasAnyFlags(Perception.BallZones, EMF_PitchZone::DefensiveThird));
+    BlackboardWriter.SetBool(MF_SyncKeys::BallInAttackingThird, EnumHasAnyFlags(Perception.BallZones, EMF_PitchZone::AttackingThird));
 
     // ==================== GOALKEEPER TARGET DAMPING ====================
     // Goalkeepers can jitter/circle if their MoveTo target changes every tick.
     // Provide a cached/thresholded target that changes less often.
     // NOTE: Reduced thresholds (150->50cm, 0.25->0.08s) for more responsive GK movement
-    if (AIProfile.Contains(TEXT("Goalkeeper")))
+    if (PlayerRole == EMF_PlayerRole::Goalkeeper)
     {
         constexpr float MinTargetMoveDist = 50.0f;    // cm (was 150.0f - too sluggish)
         constexpr float MinTargetUpdateInterval = 0.08f; // seconds (was 0.25f - too slow)
@@ -1705,16 +1958,19 @@ void AMF_PlayerCharacter::SyncBlackboard()
         const float Now = GetWorld()->GetTimeSeconds();
         const bool bHasCached = !CachedGKTargetPosition.IsZero();
         const bool bEnoughTime = (Now - LastGKTargetUpdateTime) >= MinTargetUpdateInterval;
-        const bool bFarEnough = !bHasCached || FVector::DistSquared(CachedGKTargetPosition, SupportPos) >= FMath::Square(MinTargetMoveDist);
+        const bool bFarEnough = !bHasCached || FVector::DistSquared(CachedGKTargetPosition, Perception.SupportPosition) >= FMath::Square(MinTargetMoveDist);
 
         if (!bHasCached || (bEnoughTime && bFarEnough))
         {
-            CachedGKTargetPosition = SupportPos;
+            CachedGKTargetPosition = Perception.SupportPosition;
             LastGKTargetUpdateTime = Now;
         }
 
-        AIComponent->SetBlackboardVector(TEXT("GK_TargetPosition"), CachedGKTargetPosition);
+        BlackboardWriter.SetVector(MF_SyncKeys::GK_TargetPosition, CachedGKTargetPosition);
     }
+
+    // Push only the values that changed since the last sync
+    BlackboardWriter.Flush(AIComponent);
 }
 
 void AMF_PlayerCharacter::OnBallPossessionChanged()
@@ -1733,217 +1989,245 @@ void AMF_PlayerCharacter::OnBallPossessionChanged()
     }
 }
 
-FVector AMF_PlayerCharacter::CalculateSupportPosition(const FVector& BallPosition, EMF_TeamID MyTeam) const
+namespace MF_SupportPosition
 {
-    // Calculate a supporting position based on ball location and role
-    const float OffsetFromBall = 500.0f; // 5 meters
-    const float SideOffset = 300.0f;     // 3 meters to the side
-
-    // Get vital game state info
-    AMF_GameState* GS = GetWorld()->GetGameState<AMF_GameState>();
-    
-    // Default to strict support
-    FVector SupportPos = BallPosition;
-    
-    // Determine attack direction based on team
-    // TeamA (at +Y) attacks Negative Y (Goal is at -5250)
-    // TeamB (at -Y) attacks Positive Y (Goal is at +5250)
-    float AttackDirection = (MyTeam == EMF_TeamID::TeamA) ? -1.0f : 1.0f;
-
-    // Check if my team has the ball (Attacking vs Defending)
-    bool bMyTeamHasBall = true; // Default to attacking logic if unsure
-    if (GS)
-    {
-        bMyTeamHasBall = GS->TeamHasBall(MyTeam);
-    }
-    
-    // Get current location
-    FVector MyLocation = GetActorLocation();
-
-    // ==================== BALL CARRIER LOGIC ====================
-    // If I HAVE the ball, my "SupportPosition" should be a safe dribbling target
-    if (HasBall())
-    {
-        // Target: Center of opponent goal line
-        float GoalY = (MF_Constants::FieldLength / 2.0f) * AttackDirection;
-        FVector GoalPos(0.0f, GoalY, MF_Constants::GroundZ);
-        
-        // Point 10 meters ahead towards goal
-        FVector DirToGoal = (GoalPos - MyLocation).GetSafeNormal();
-        FVector DribblePos = MyLocation + (DirToGoal * 1000.0f);
-        
-        // Bias towards center: if we are near sidelines, push X towards 0
-        if (FMath::Abs(DribblePos.X) > 2000.0f)
-        {
-            DribblePos.X *= 0.7f;
-        }
-        
-        return DribblePos;
-    }
-    
-    // Helper to calculate "Home" position effectively
-    // Use SpawnLocation, but ensure it's not ZeroVector (fallback to calculated formation)
-    FVector EffectiveHome = (SpawnLocation.IsNearlyZero()) ? MyLocation : SpawnLocation;
+    /** Everything the per-role support rules read */
+    struct FContext
+    {
+        FVector BallPosition;
+        FVector MyLocation;
+        FVector EffectiveHome;
+        FVector CenterSpot;
+        FVector2D HalfExtent;
+        float AttackDirection;
+        float MyGoalLineY;
+        float GoalHalfWidth;
+        bool bMyTeamHasBall;
+        uint8 PlayerID;
+    };
+
+    using FRoleRule = FVector (*)(const FContext &);
 
     // ==================== STRIKER LOGIC ====================
-    if (AIProfile.Contains(TEXT("Striker")))
+    FVector Striker(const FContext &Ctx)
     {
-        if (bMyTeamHasBall)
+        FVector SupportPos = Ctx.BallPosition;
+        if (Ctx.bMyTeamHasBall)
         {
             // ATTACKING: Get in position to score
             // Position ahead of the ball towards opponent goal (Along Y)
-            SupportPos.Y += 1000.0f * AttackDirection;
-            
+            SupportPos.Y += 1000.0f * Ctx.AttackDirection;
+
             // Unclump logic: Use PlayerID to spread out circle-wise or line-wise
             // Max separation: 1200 units width
             // Map PlayerID (0-255) to a -1.0 to 1.0 range based on modulo to ensure distinct slots
             // Slot 0: Center, Slot 1: Right, Slot 2: Left, etc.
-            int32 Slot = PlayerID % 3; 
+            int32 Slot = Ctx.PlayerID % 3;
             float SpreadFactor = 0.0f;
             if (Slot == 1) SpreadFactor = 1.0f;
             else if (Slot == 2) SpreadFactor = -1.0f;
 
-            SupportPos.X += SpreadFactor * 600.0f; 
+            SupportPos.X += SpreadFactor * 600.0f;
         }
         else
         {
             // DEFENDING: Stay high up field (cherry pick) or press if close
             // Don't drop back too far. Stay near center circle or opponents defensive third.
             // Target: Stay high up field (Cherry Pick) near opponent defenders
-            float TargetY = 2500.0f * AttackDirection; // Keep pressure high in opponent half
-            SupportPos = FVector(EffectiveHome.X, TargetY, MF_Constants::GroundZ);
-            
+            // Keep pressure high in opponent half (about halfway to their goal line: 25m on the default pitch)
+            float TargetY = Ctx.CenterSpot.Y + (0.48f * Ctx.HalfExtent.Y * Ctx.AttackDirection);
+            SupportPos = FVector(Ctx.EffectiveHome.X, TargetY, MF_Constants::GroundZ);
+
             // If ball is very close, press it (this is handled by AmIClosestToBall, but position ref helps)
-            if (FVector::Dist(MyLocation, BallPosition) < 1500.0f)
+            if (FVector::Dist(Ctx.MyLocation, Ctx.BallPosition) < 1500.0f)
             {
-               SupportPos = BallPosition; 
+                SupportPos = Ctx.BallPosition;
             }
         }
+        return SupportPos;
     }
+
     // ==================== MIDFIELDER LOGIC ====================
-    else if (AIProfile.Contains(TEXT("Midfielder")))
+    FVector Midfielder(const FContext &Ctx)
     {
-        if (bMyTeamHasBall)
+        FVector SupportPos = Ctx.BallPosition;
+        if (Ctx.bMyTeamHasBall)
         {
             // ATTACKING: Support the striker, stay behind ball
             // Triangle formation support
             float Spread = 900.0f;
-            SupportPos.Y -= 600.0f * AttackDirection; // Behind ball
-            
+            SupportPos.Y -= 600.0f * Ctx.AttackDirection; // Behind ball
+
             // Spread based on ID
-            int32 Slot = PlayerID % 2;
+            int32 Slot = Ctx.PlayerID % 2;
             float SpreadDir = (Slot == 0) ? 1.0f : -1.0f;
-            SupportPos.X = BallPosition.X + (Spread * SpreadDir);
+            SupportPos.X = Ctx.BallPosition.X + (Spread * SpreadDir);
         }
         else
         {
             // DEFENDING: Defensive Screen
             // Position between Ball and Our Goal (Screening)
-            // Goal Y is roughly +/- 5250
-            float MyGoalY = (MF_Constants::FieldLength / 2.0f) * -AttackDirection; 
-            FVector MyGoalPos(0.0f, MyGoalY, 0.0f);
-            
+            FVector MyGoalPos(Ctx.CenterSpot.X, Ctx.MyGoalLineY, 0.0f);
+
             // Block path to goal at 20% mark (closer to ball to allow pressing)
-            SupportPos = FMath::Lerp(BallPosition, MyGoalPos, 0.2f);
-            
+            SupportPos = FMath::Lerp(Ctx.BallPosition, MyGoalPos, 0.2f);
+
             // Add some width based on ID to cover passing lanes
             float Spread = 400.0f; // Tighter while defending
-            int32 Slot = PlayerID % 2;
-             float SpreadDir = (Slot == 0) ? 1.0f : -1.0f;
+            int32 Slot = Ctx.PlayerID % 2;
+            float SpreadDir = (Slot == 0) ? 1.0f : -1.0f;
             SupportPos.X += Spread * SpreadDir;
         }
+        return SupportPos;
     }
+
     // ==================== DEFENDER LOGIC ====================
-    else if (AIProfile.Contains(TEXT("Defender")))
+    FVector Defender(const FContext &Ctx)
     {
         // Defenders: Anchor to HOME (SpawnLocation/Defensive Third)
         // Adjust engagement based on threat level
-        
-        // Calculate threat zone: How close is ball to our goal?
-        float MyGoalY = (MF_Constants::FieldLength / 2.0f) * -AttackDirection;
-        float DistBallToGoal = FMath::Abs(BallPosition.Y - MyGoalY);
-        float FieldLen = MF_Constants::FieldLength;
-        
-        // ThreatRatio: 0.0 (Far) to 1.0 (In Goal Mouth)
-        float ThreatRatio = 1.0f - FMath::Clamp(DistBallToGoal / (FieldLen * 0.6f), 0.0f, 1.0f);
-        
-        if (bMyTeamHasBall)
+        FVector SupportPos = Ctx.BallPosition;
+
+        float MyGoalY = Ctx.MyGoalLineY;
+
+        if (Ctx.bMyTeamHasBall)
         {
             // ATTACKING: Move up to half-way line or maintain structure
             // Stay largely at EffectiveHome but shift Y up slightly
-            SupportPos = EffectiveHome;
-            SupportPos.Y -= 500.0f * AttackDirection; // Shift up slightly
+            SupportPos = Ctx.EffectiveHome;
+            SupportPos.Y -= 500.0f * Ctx.AttackDirection; // Shift up slightly
         }
         else
         {
             // DEFENDING: Dynamic Engagement
-            // If threat is high (> 0.7), move to Ball
-            // If threat is low (< 0.3), stay Home
-            // Otherwise blend
-            
-            if (ThreatRatio > 0.7f)
+            // Ball within 18% of the pitch length of our goal line (any width): move to Ball
+            // Otherwise hold the lane between ball and goal
+            const float ThreatDistance = 0.18f * (2.0f * Ctx.HalfExtent.Y);
+
+            if (FMath::Abs(Ctx.BallPosition.Y - MyGoalY) < ThreatDistance)
             {
                 // CRITICAL DEFENSE: Convert to ball chaser behavior essentially
                 // We define this via position - if position == ball, DistToSupport becomes 0
-                SupportPos = BallPosition;
+                SupportPos = Ctx.BallPosition;
             }
             else
             {
                 // ZONAL DEFENSE: Position between Ball and Goal, biased by Home X
-                FVector MyGoalPos(0.0f, MyGoalY, 0.0f);
-                
+                FVector MyGoalPos(Ctx.CenterSpot.X, MyGoalY, 0.0f);
+
                 // Intercept vector
-                FVector InterceptPos = FMath::Lerp(BallPosition, MyGoalPos, 0.25f);
-                
+                FVector InterceptPos = FMath::Lerp(Ctx.BallPosition, MyGoalPos, 0.25f);
+
                 // Blend Intercept Y with Home X to maintain lane
-                SupportPos.X = EffectiveHome.X; 
+                SupportPos.X = Ctx.EffectiveHome.X;
                 SupportPos.Y = InterceptPos.Y;
-                
+
                 // If ball is on our flank, shift X to cover
-                if (FMath::Abs(BallPosition.X - EffectiveHome.X) < 1000.0f)
+                if (FMath::Abs(Ctx.BallPosition.X - Ctx.EffectiveHome.X) < 1000.0f)
                 {
-                    SupportPos.X = FMath::Lerp(EffectiveHome.X, BallPosition.X, 0.5f);
+                    SupportPos.X = FMath::Lerp(Ctx.EffectiveHome.X, Ctx.BallPosition.X, 0.5f);
                 }
             }
         }
+        return SupportPos;
     }
+
     // ==================== GOALKEEPER LOGIC ====================
-    else if (AIProfile.Contains(TEXT("Goalkeeper")))
+    FVector Goalkeeper(const FContext &Ctx)
     {
         // Goalkeeper stays in goal area but shifts X to match ball (cut off angle)
-        // Goal is at +/- FieldLength/2
-        float GoalLineY = (MF_Constants::FieldLength / 2.0f) * -AttackDirection; 
-        
+        float GoalLineY = Ctx.MyGoalLineY;
+
         // Stay slightly off line (200 units)
-        float BaseY = GoalLineY + (200.0f * AttackDirection);
-        
+        float BaseY = GoalLineY + (200.0f * Ctx.AttackDirection);
+
         // Match Ball X but clamp to Goal Width (plus a bit of margin)
-        // Goal Width is 7.32m (732 units). Half is 366.
-        float ClampedX = FMath::Clamp(BallPosition.X, -400.0f, 400.0f);
-        
-        SupportPos = FVector(ClampedX, BaseY, MF_Constants::GroundZ);
-        
+        const float PostMargin = 35.0f;
+        float ClampedX = FMath::Clamp(Ctx.BallPosition.X, -(Ctx.GoalHalfWidth + PostMargin), Ctx.GoalHalfWidth + PostMargin);
+
+        FVector SupportPos(ClampedX, BaseY, MF_Constants::GroundZ);
+
         // ENGAGEMENT: If ball is very close (inside box approx), rush it?
         // Penalty Box is ~16m deep (1650 units).
-        float DistFromLine = FMath::Abs(BallPosition.Y - GoalLineY);
-        if (DistFromLine < 1200.0f && FMath::Abs(BallPosition.X) < 1500.0f && !bMyTeamHasBall)
+        float DistFromLine = FMath::Abs(Ctx.BallPosition.Y - GoalLineY);
+        if (DistFromLine < 1200.0f && FMath::Abs(Ctx.BallPosition.X) < 1500.0f && !Ctx.bMyTeamHasBall)
         {
             // Rush ball if in box and opponent has it/loose
-            SupportPos = BallPosition;
+            SupportPos = Ctx.BallPosition;
         }
+        return SupportPos;
     }
+
     // ==================== DEFAULT LOGIC ====================
-    else
+    FVector Default(const FContext &Ctx)
     {
         // Default: follow ball loosely
-        SupportPos.Y += OffsetFromBall * 0.5f * AttackDirection;
+        const float OffsetFromBall = 500.0f; // 5 meters
+        FVector SupportPos = Ctx.BallPosition;
+        SupportPos.Y += OffsetFromBall * 0.5f * Ctx.AttackDirection;
+        return SupportPos;
+    }
+
+    /** Indexed by EMF_PlayerRole */
+    constexpr FRoleRule RoleRules[] = {&Goalkeeper, &Defender, &Midfielder, &Striker, &Default};
+    static_assert(UE_ARRAY_COUNT(RoleRules) == static_cast<int32>(EMF_PlayerRole::None) + 1, "One support rule per EMF_PlayerRole");
+}
+
+FVector AMF_PlayerCharacter::CalculateSupportPosition(const FMF_FieldLandmarks &Landmarks, const FVector& BallPosition, EMF_TeamID MyTeam, bool bMyTeamHasBall) const
+{
+    // Determine attack direction based on team (from the field's published goals)
+    // TeamA (at +Y) attacks Negative Y, TeamB (at -Y) attacks Positive Y on the default layout
+    float AttackDirection = Landmarks.GetAttackSign(MyTeam);
+
+    // bMyTeamHasBall selects attacking vs defending logic (false while the ball is loose)
+
+    // Get current location
+    FVector MyLocation = GetActorLocation();
+
+    // ==================== BALL CARRIER LOGIC ====================
+    // If I HAVE the ball, my "SupportPosition" should be a safe dribbling target
+    if (HasBall())
+    {
+        // Target: Center of opponent goal line
+        float GoalY = Landmarks.GetGoalLineY(FMF_FieldLandmarks::Opponent(MyTeam));
+        FVector GoalPos(Landmarks.CenterSpot.X, GoalY, MF_Constants::GroundZ);
+        
+        // Point 10 meters ahead towards goal
+        FVector DirToGoal = (GoalPos - MyLocation).GetSafeNormal();
+        FVector DribblePos = MyLocation + (DirToGoal * 1000.0f);
+        
+        // Bias towards center: if we are near sidelines, push X towards 0
+        if (FMath::Abs(DribblePos.X) > 2000.0f)
+        {
+            DribblePos.X *= 0.7f;
+        }
+        
+        return DribblePos;
     }
     
+    // Helper to calculate "Home" position effectively
+    // Use SpawnLocation, but ensure it's not ZeroVector (fallback to calculated formation)
+    MF_SupportPosition::FContext Ctx;
+    Ctx.BallPosition = BallPosition;
+    Ctx.MyLocation = MyLocation;
+    Ctx.EffectiveHome = (SpawnLocation.IsNearlyZero()) ? MyLocation : SpawnLocation;
+    Ctx.CenterSpot = Landmarks.CenterSpot;
+    Ctx.HalfExtent = Landmarks.HalfExtent;
+    Ctx.AttackDirection = AttackDirection;
+    Ctx.MyGoalLineY = Landmarks.GetGoalLineY(MyTeam);
+    Ctx.GoalHalfWidth = Landmarks.GoalHalfWidth;
+    Ctx.bMyTeamHasBall = bMyTeamHasBall;
+    Ctx.PlayerID = PlayerID;
+
+    // Per-role rule, dispatched on the cached role
+    const int32 RoleIndex = FMath::Min(static_cast<int32>(PlayerRole), static_cast<int32>(EMF_PlayerRole::None));
+    FVector SupportPos = MF_SupportPosition::RoleRules[RoleIndex](Ctx);
+    
     // Clamp to field bounds (Safety net)
-    const float HalfLength = MF_Constants::FieldLength / 2.0f - 100.0f; // Buffer
-    const float HalfWidth = MF_Constants::FieldWidth / 2.0f - 100.0f;
-    SupportPos.X = FMath::Clamp(SupportPos.X, -HalfWidth, HalfWidth); // Width is X
-    SupportPos.Y = FMath::Clamp(SupportPos.Y, -HalfLength, HalfLength); // Length is Y
+    const float HalfLength = Landmarks.HalfExtent.Y - 100.0f; // Buffer
+    const float HalfWidth = Landmarks.HalfExtent.X - 100.0f;
+    SupportPos.X = FMath::Clamp(SupportPos.X, Landmarks.CenterSpot.X - HalfWidth, Landmarks.CenterSpot.X + HalfWidth); // Width is X
+    SupportPos.Y = FMath::Clamp(SupportPos.Y, Landmarks.CenterSpot.Y - HalfLength, Landmarks.CenterSpot.Y + HalfLength); // Length is Y
     SupportPos.Z = MF_Constants::GroundZ;
     
     return SupportPos;
@@ -1955,23 +2239,27 @@ FVector AMF_PlayerCharacter::CalculateSeparationVector() const
     const float SeparationRadius = 250.0f; // 2.5 meters
     const float SeparationStrength = 1.6f; // Strong nudging to prevent clumping
 
-    // Find nearby teammates
-    for (TActorIterator<AMF_PlayerCharacter> It(GetWorld()); It; ++It)
+    UMF_PlayerSnapshotSubsystem *Snapshots = UMF_PlayerSnapshotSubsystem::Get(this);
+    if (!Snapshots)
     {
-        AMF_PlayerCharacter* Other = *It;
-        
-        // Skip self and non-teammates
-        if (!Other || Other == this || Other->GetTeamID() != TeamID)
-        {
-            continue;
-        }
+        return FVector::ZeroVector;
+    }
+    const FMF_PlayerSnapshot &Snapshot = Snapshots->GetSnapshot();
+    const int32 MyIndex = Snapshot.IndexOf(this);
+    const FVector MyLocation = GetActorLocation();
+
+    // Find nearby teammates (grid query already skips self and non-teammates)
+    TArray<int32> Nearby;
+    Snapshot.Grid.QueryRadius(MyLocation, SeparationRadius, MF_TeamMask::Only(TeamID), Nearby, MyIndex);
 
-        float Dist = FVector::Dist(GetActorLocation(), Other->GetActorLocation());
+    for (const int32 Index : Nearby)
+    {
+        float Dist = FVector::Dist(MyLocation, Snapshot.Positions[Index]);
         
         // If within radius, add repulsion
         if (Dist < SeparationRadius && Dist > 1.0f)
         {
-            FVector ToMe = GetActorLocation() - Other->GetActorLocation();
+            FVector ToMe = MyLocation - Snapshot.Positions[Index];
             
             // Stronger repulsion the closer they are
             float Weight = 1.0f - (Dist / SeparationRadius);
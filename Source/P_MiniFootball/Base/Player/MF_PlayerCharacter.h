@@ -11,6 +11,11 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Character.h"
 #include "Core/MF_Types.h"
+#include "Core/MF_Formation.h"
+#include "Core/MF_TargetCache.h"
+#include "AI/MF_BlackboardWriter.h"
+#include "AI/MF_AgentPerception.h"
+#include "Player/MF_PlayerReplicationData.h"
 #include "EAIS_TargetProvider.h"
 #include "MF_PlayerCharacter.generated.h"
 
@@ -25,6 +30,7 @@ class UAIComponent;
 class UAIBehaviour;
 class UNavigationInvokerComponent;
 class UTextRenderComponent;
+struct FMF_PlayerSnapshot;
 
 // ==================== Delegates ====================
 
@@ -61,6 +67,7 @@ public:
 
     virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty> &OutLifetimeProps) const override;
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     virtual void Tick(float DeltaTime) override;
     virtual void SetupPlayerInputComponent(class UInputComponent *PlayerInputComponent) override;
     virtual void PossessedBy(AController *NewController) override;
@@ -68,6 +75,10 @@ public:
     virtual void OnRep_Owner() override; // Called on client when possessed
     virtual void OnRep_PlayerState() override;
 
+    /** Default net driver only: priority by activity tier and distance to the viewer's focus and to the ball (see UMF_NetworkSettings) */
+    virtual float GetNetPriority(const FVector &ViewPos, const FVector &ViewDir, AActor *Viewer, AActor *ViewTarget,
+                                 UActorChannel *InChannel, float Time, bool bLowBandwidth) override;
+
     // ==================== Team & Identity ====================
 
     /** Get this player's team */
@@ -83,7 +94,22 @@ public:
     uint8 GetPlayerID() const { return PlayerID; }
 
     /** Set player ID (Server only) */
-    void SetPlayerID(uint8 NewID) { PlayerID = NewID; }
+    void SetPlayerID(uint8 NewID);
+
+    /**
+     * Match-wide slot (0..N-1) assigned once by AMF_GameMode::SpawnTeamCharacter, unique across
+     * both teams. Possession is replicated by it and subsystems index flat per-player arrays with it.
+     * MF_Constants::InvalidMatchSlot for characters the game mode did not spawn.
+     */
+    UFUNCTION(BlueprintPure, Category = "MiniFootball|Player")
+    uint8 GetMatchSlot() const { return MatchSlot; }
+
+    /** Set match slot (Server only) */
+    void SetMatchSlot(uint8 NewSlot);
+
+    /** Role resolved from AIProfile (cached; refreshed whenever the profile changes) */
+    UFUNCTION(BlueprintPure, Category = "MiniFootball|Player")
+    EMF_PlayerRole GetPlayerRole() const { return PlayerRole; }
 
     // ==================== Ball Possession ====================
 
@@ -106,13 +132,20 @@ public:
     bool CanReceiveBall() const;
 
     /**
-     * CurrentBall - Replicated reference to the ball this character possesses.
+     * CurrentBall - Reference to the ball this character possesses.
      * This is the single source of truth for ball possession on the character side.
+     * Replicated by ball slot in ReplicatedState; clients resolve it through the game state.
      * Invariant: bHasBall == (CurrentBall != nullptr)
      */
-    UPROPERTY(ReplicatedUsing = OnRep_CurrentBall, BlueprintReadOnly, Category = "MiniFootball|Player")
+    UPROPERTY(BlueprintReadOnly, Category = "MiniFootball|Player")
     AMF_Ball *CurrentBall = nullptr;
 
+    /** Set CurrentBall (Server only; called by AMF_Ball on possession changes) */
+    void SetCurrentBall(AMF_Ball *Ball);
+
+    /** Client: resolve CurrentBall from the replicated ball slot (AMF_Ball calls this when its possessor replicates) */
+    void ResolveCurrentBall(AMF_Ball *Fallback = nullptr);
+
     // ==================== Player State ====================
 
     /** Get current player state */
@@ -142,8 +175,8 @@ public:
     bool IsSprinting() const { return bIsSprinting; }
 
     // ==================== AI Configuration ====================
-    /** The AI Behavior profile to use */
-    UPROPERTY(ReplicatedUsing = OnRep_AIProfile, EditAnywhere, BlueprintReadWrite, Category = "AI|Config")
+    /** The AI Behavior profile to use (clients only see the profile of its role, see ReplicatedState) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|Config")
     FString AIProfile = TEXT("Striker");
 
     /** Optional: Pre-assigned behavior asset */
@@ -258,24 +291,36 @@ protected:
 
     // ==================== Replicated Properties ====================
 
+    /**
+     * TeamID, PlayerID, MatchSlot, role (AIProfile), state, sprint and possession packed into one property.
+     * The server writes it from the fields below (PublishReplicatedState); clients unpack it
+     * back into them and run the per-field OnRep hooks for whatever changed.
+     */
+    UPROPERTY(ReplicatedUsing = OnRep_ReplicatedState)
+    FMF_PlayerReplicationData ReplicatedState;
+
     /** Team this player belongs to */
-    UPROPERTY(ReplicatedUsing = OnRep_TeamID, BlueprintReadOnly, Category = "MiniFootball|Player")
+    UPROPERTY(BlueprintReadOnly, Category = "MiniFootball|Player")
     EMF_TeamID TeamID = EMF_TeamID::None;
 
-    /** Unique player ID in match */
-    UPROPERTY(Replicated, BlueprintReadOnly, Category = "MiniFootball|Player")
+    /** Player index within the team (formation slot) */
+    UPROPERTY(BlueprintReadOnly, Category = "MiniFootball|Player")
     uint8 PlayerID = 0;
 
+    /** Match-wide slot (see GetMatchSlot) */
+    UPROPERTY(BlueprintReadOnly, Category = "MiniFootball|Player")
+    uint8 MatchSlot = MF_Constants::InvalidMatchSlot;
+
     /** Whether this player has the ball (derived from CurrentBall but replicated for UI/prediction) */
-    UPROPERTY(ReplicatedUsing = OnRep_HasBall, BlueprintReadOnly, Category = "MiniFootball|Player")
+    UPROPERTY(BlueprintReadOnly, Category = "MiniFootball|Player")
     bool bHasBall = false;
 
     /** Current player state */
-    UPROPERTY(ReplicatedUsing = OnRep_CurrentPlayerState, BlueprintReadOnly, Category = "MiniFootball|Player")
+    UPROPERTY(BlueprintReadOnly, Category = "MiniFootball|Player")
     EMF_PlayerState CurrentPlayerState = EMF_PlayerState::Idle;
 
     /** Sprint state */
-    UPROPERTY(Replicated, BlueprintReadOnly, Category = "MiniFootball|Player")
+    UPROPERTY(BlueprintReadOnly, Category = "MiniFootball|Player")
     bool bIsSprinting = false;
 
     // ==================== Non-Replicated State ====================
@@ -306,14 +351,47 @@ protected:
     UPROPERTY(BlueprintReadOnly, Category = "MiniFootball|Formation")
     FVector SpawnLocation = FVector::ZeroVector;
 
+    /** Role parsed from AIProfile once, so hot paths never string-search the profile name */
+    EMF_PlayerRole PlayerRole = EMF_PlayerRole::None;
+
+    /** Re-resolve PlayerRole from AIProfile (BeginPlay, SetAIProfile, OnRep_AIProfile) */
+    void RefreshPlayerRole();
+
+    /** Server: repack ReplicatedState from the fields; if anything changed, mark it dirty and force a net update */
+    void PublishReplicatedState();
+
+    /** Update-rate tier last applied (Server only, see UMF_NetworkSettings) */
+    EMF_NetActivity NetActivity = EMF_NetActivity::None;
+
+    /** Server: re-classify activity and switch NetUpdateFrequency/priority tier on change */
+    void UpdateNetActivity();
+
     /** Cached goalkeeper target position to avoid MoveTo churn/jitter */
     FVector CachedGKTargetPosition = FVector::ZeroVector;
 
     /** Last time we updated CachedGKTargetPosition */
     float LastGKTargetUpdateTime = -1000.0f;
 
+    /** Per-frame table of resolved EAIS actor targets (see EAIS_GetTargetActor) */
+    mutable FMF_TargetCache TargetCache;
+
+    /** Batches SyncBlackboard writes and skips values that did not change */
+    FMF_BlackboardWriter BlackboardWriter;
+
+    /** True while UMF_AISyncScheduler owns this agent's blackboard sync (Tick skips it) */
+    bool bBlackboardSyncScheduled = false;
+
+    /** (Re)register with the AI sync scheduler after the AI component starts */
+    void RegisterWithAISyncScheduler();
+
+    friend class UMF_AISyncScheduler;
+
     // ==================== Rep Notifies ====================
 
+    /** Unpacks ReplicatedState and dispatches to the per-field hooks below */
+    UFUNCTION()
+    void OnRep_ReplicatedState();
+
     UFUNCTION()
     void OnRep_TeamID();
 
@@ -331,21 +409,33 @@ protected:
 
     // ==================== Internal Functions ====================
 
-    /** Synchronize game state to AI blackboard */
+    /** Synchronize game state to AI blackboard (gather + perceive + apply, all on the game thread) */
     void SyncBlackboard();
 
+    /** Game thread: resolve targets (ball, opponent goal) the perception pass needs */
+    void GatherPerceptionInput(const FMF_PlayerSnapshot &Snapshot, FMF_AgentPerceptionInput &OutInput) const;
+
+    /** Any thread: compute perception from the frozen snapshot. Must not write to UObjects. */
+    void ComputePerception(const FMF_PlayerSnapshot &Snapshot, const FMF_AgentPerceptionInput &Input, FMF_AgentPerception &OutPerception) const;
+
+    /** Game thread: write perception results and remaining state to the blackboard */
+    void ApplyPerception(const FMF_PlayerSnapshot &Snapshot, const FMF_AgentPerceptionInput &Input, const FMF_AgentPerception &Perception);
+
     /** Called when possession changes - update AI blackboard */
     void OnBallPossessionChanged();
 
     /** Update the 3D text indicator (Text & Color) */
     void UpdatePlayerIndicator();
 
-    /** Calculate intelligent support position based on ball location and role */
-    FVector CalculateSupportPosition(const FVector& BallPosition, EMF_TeamID MyTeam) const;
+    /** Calculate intelligent support position based on ball location and role (thread-safe, no world queries) */
+    FVector CalculateSupportPosition(const FMF_FieldLandmarks &Landmarks, const FVector& BallPosition, EMF_TeamID MyTeam, bool bMyTeamHasBall) const;
 
     /** Calculate a separation vector to prevent clumping with teammates */
     FVector CalculateSeparationVector() const;
 
+    /** Resolve an actor target from the snapshot (uncached path behind EAIS_GetTargetActor) */
+    bool ResolveTargetActor(EMF_TargetID Id, const FMF_PlayerSnapshot &Snapshot, AActor *&OutActor) const;
+
     /** Setup input bindings via InputHandler */
     void SetupInputBindings();
 
@@ -16,6 +16,7 @@
 #include "MF_Utilities.h"
 #include "Interfaces/MF_TeamInterface.h"
 #include "Net/UnrealNetwork.h"
+#include "Net/Core/PushModel/PushModel.h"
 #include "Kismet/GameplayStatics.h"
 #include "GameFramework/GameModeBase.h"
 
@@ -110,11 +111,15 @@ void AMF_PlayerController::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>
 {
     Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
-    DOREPLIFETIME(AMF_PlayerController, AssignedTeam);
-    DOREPLIFETIME(AMF_PlayerController, TeamCharacters);
-    DOREPLIFETIME(AMF_PlayerController, ActiveCharacterIndex);
-    DOREPLIFETIME(AMF_PlayerController, bIsSpectator);
-    DOREPLIFETIME(AMF_PlayerController, CurrentSpectatorState);
+    // Push model: team/spectator state only changes on assignment and character switches
+    FDoRepLifetimeParams Params;
+    Params.bIsPushBased = true;
+
+    DOREPLIFETIME_WITH_PARAMS_FAST(AMF_PlayerController, AssignedTeam, Params);
+    DOREPLIFETIME_WITH_PARAMS_FAST(AMF_PlayerController, TeamCharacters, Params);
+    DOREPLIFETIME_WITH_PARAMS_FAST(AMF_PlayerController, ActiveCharacterIndex, Params);
+    DOREPLIFETIME_WITH_PARAMS_FAST(AMF_PlayerController, bIsSpectator, Params);
+    DOREPLIFETIME_WITH_PARAMS_FAST(AMF_PlayerController, CurrentSpectatorState, Params);
 }
 
 void AMF_PlayerController::BeginPlay()
@@ -277,6 +282,7 @@ void AMF_PlayerController::AssignToTeam(EMF_TeamID NewTeam)
     if (AssignedTeam != NewTeam)
     {
         AssignedTeam = NewTeam;
+        MARK_PROPERTY_DIRTY_FROM_NAME(AMF_PlayerController, AssignedTeam, this);
         OnRep_AssignedTeam();
 
         UE_LOG(LogTemp, Log, TEXT("MF_PlayerController::AssignToTeam - Assigned to team: %d"),
@@ -490,6 +496,8 @@ void AMF_PlayerController::SetSpectatorState(EMF_SpectatorState NewState)
     {
         CurrentSpectatorState = NewState;
         bIsSpectator = (NewState == EMF_SpectatorState::Spectating);
+        MARK_PROPERTY_DIRTY_FROM_NAME(AMF_PlayerController, CurrentSpectatorState, this);
+        MARK_PROPERTY_DIRTY_FROM_NAME(AMF_PlayerController, bIsSpectator, this);
         OnRep_SpectatorState();
 
         UE_LOG(LogTemp, Log, TEXT("MF_PlayerController::SetSpectatorState - Set to: %d"),
@@ -681,6 +689,7 @@ void AMF_PlayerController::RegisterTeamCharacter(AMF_PlayerCharacter *InCharacte
     }
 
     TeamCharacters.Add(InCharacter);
+    MARK_PROPERTY_DIRTY_FROM_NAME(AMF_PlayerController, TeamCharacters, this);
 
     UE_LOG(LogTemp, Log, TEXT("MF_PlayerController::RegisterTeamCharacter - Registered %s (Total: %d, Spectator: %d, ActiveIndex: %d)"),
            *InCharacter->GetName(), TeamCharacters.Num(), bIsSpectator, ActiveCharacterIndex);
@@ -704,6 +713,7 @@ void AMF_PlayerController::UnregisterTeamCharacter(AMF_PlayerCharacter *InCharac
     if (Index != INDEX_NONE)
     {
         TeamCharacters.RemoveAt(Index);
+        MARK_PROPERTY_DIRTY_FROM_NAME(AMF_PlayerController, TeamCharacters, this);
 
         // If we removed our active character, switch to another
         if (ActiveCharacterIndex == Index)
@@ -716,12 +726,14 @@ void AMF_PlayerController::UnregisterTeamCharacter(AMF_PlayerCharacter *InCharac
             else
             {
                 ActiveCharacterIndex = -1;
+                MARK_PROPERTY_DIRTY_FROM_NAME(AMF_PlayerController, ActiveCharacterIndex, this);
             }
         }
         else if (ActiveCharacterIndex > Index)
         {
             // Adjust index since array shifted
             ActiveCharacterIndex--;
+            MARK_PROPERTY_DIRTY_FROM_NAME(AMF_PlayerController, ActiveCharacterIndex, this);
         }
 
         UE_LOG(LogTemp, Log, TEXT("MF_PlayerController::UnregisterTeamCharacter - Unregistered %s"),
@@ -875,6 +887,7 @@ void AMF_PlayerController::Internal_SwitchToCharacter(int32 CharacterIndex)
     // Possess new character
     Possess(NewCharacter);
     ActiveCharacterIndex = CharacterIndex;
+    MARK_PROPERTY_DIRTY_FROM_NAME(AMF_PlayerController, ActiveCharacterIndex, this);
 
     // Notify client
     Client_OnCharacterSwitched(NewCharacter);
@@ -991,6 +1004,7 @@ void AMF_PlayerController::SetSpectatorMode(bool bEnabled)
     }
 
     bIsSpectator = bEnabled;
+    MARK_PROPERTY_DIRTY_FROM_NAME(AMF_PlayerController, bIsSpectator, this);
 
     if (bEnabled)
     {
@@ -1000,6 +1014,7 @@ void AMF_PlayerController::SetSpectatorMode(bool bEnabled)
             UnPossess();
         }
         ActiveCharacterIndex = -1;
+        MARK_PROPERTY_DIRTY_FROM_NAME(AMF_PlayerController, ActiveCharacterIndex, this);
         UE_LOG(LogTemp, Log, TEXT("MF_PlayerController::SetSpectatorMode - Spectator mode ENABLED"));
     }
     else
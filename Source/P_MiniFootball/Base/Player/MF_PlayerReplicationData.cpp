@@ -0,0 +1,58 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: MF_PlayerReplicationData - Implementation (packed serializer)
+ * @Date: 16/10/2026
+ */
+
+#include "Player/MF_PlayerReplicationData.h"
+
+namespace
+{
+    // Bit layout of the packed word: team | role | state | sprinting | has ball
+    constexpr uint32 TeamBits = 2;
+    constexpr uint32 RoleBits = 3;
+    constexpr uint32 StateBits = 3;
+    constexpr uint32 PackedBits = TeamBits + RoleBits + StateBits + 2;
+
+    constexpr uint32 RoleShift = TeamBits;
+    constexpr uint32 StateShift = RoleShift + RoleBits;
+    constexpr uint32 SprintingBit = 1u << (StateShift + StateBits);
+    constexpr uint32 HasBallBit = SprintingBit << 1;
+
+    constexpr uint32 Mask(uint32 Bits) { return (1u << Bits) - 1u; }
+}
+
+bool FMF_PlayerReplicationData::NetSerialize(FArchive &Ar, UPackageMap *Map, bool &bOutSuccess)
+{
+    uint32 Packed = 0;
+    if (Ar.IsSaving())
+    {
+        Packed = (static_cast<uint32>(TeamID) & Mask(TeamBits)) |
+                 ((static_cast<uint32>(Role) & Mask(RoleBits)) << RoleShift) |
+                 ((static_cast<uint32>(State) & Mask(StateBits)) << StateShift) |
+                 (bIsSprinting ? SprintingBit : 0u) |
+                 (bHasBall ? HasBallBit : 0u);
+    }
+    Ar.SerializeBits(&Packed, PackedBits);
+
+    if (Ar.IsLoading())
+    {
+        TeamID = static_cast<EMF_TeamID>(Packed & Mask(TeamBits));
+        Role = static_cast<EMF_PlayerRole>((Packed >> RoleShift) & Mask(RoleBits));
+        State = static_cast<EMF_PlayerState>((Packed >> StateShift) & Mask(StateBits));
+        bIsSprinting = (Packed & SprintingBit) != 0;
+        bHasBall = (Packed & HasBallBit) != 0;
+        BallSlot = UnknownBallSlot;
+    }
+
+    Ar << PlayerID;
+    Ar << MatchSlot;
+
+    if (bHasBall)
+    {
+        Ar << BallSlot;
+    }
+
+    bOutSuccess = !Ar.IsError();
+    return true;
+}
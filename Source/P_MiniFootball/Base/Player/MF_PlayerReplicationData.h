@@ -0,0 +1,76 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: MF_PlayerReplicationData - Packed replicated identity and state of a player character
+ * @Date: 16/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/MF_Types.h"
+#include "Core/MF_Formation.h"
+#include "MF_PlayerReplicationData.generated.h"
+
+class UPackageMap;
+
+/**
+ * Everything clients need about a player character except movement, as one property.
+ * NetSerialize packs team (2 bits), role (3), state (3), sprint and possession flags into
+ * 10 bits, then the player ID and match slot bytes, then a ball slot byte only while the player
+ * has the ball.
+ * The ball is referenced by slot (see AMF_GameState::GetBallBySlot), not by object, and the
+ * AI profile by its role (clients rebuild the profile name with MF_Roles::ToProfileName).
+ */
+USTRUCT(BlueprintType)
+struct P_MINIFOOTBALL_API FMF_PlayerReplicationData
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Player")
+    EMF_TeamID TeamID = EMF_TeamID::None;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Player")
+    uint8 PlayerID = 0;
+
+    /** Match-wide index assigned at spawn (see AMF_PlayerCharacter::GetMatchSlot) */
+    UPROPERTY(BlueprintReadOnly, Category = "Player")
+    uint8 MatchSlot = MF_Constants::InvalidMatchSlot;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Player")
+    EMF_PlayerRole Role = EMF_PlayerRole::None;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Player")
+    EMF_PlayerState State = EMF_PlayerState::Idle;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Player")
+    bool bIsSprinting = false;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Player")
+    bool bHasBall = false;
+
+    /** Slot of the held ball (only meaningful while bHasBall; UnknownBallSlot if the ball has none) */
+    UPROPERTY(BlueprintReadOnly, Category = "Player")
+    uint8 BallSlot = UnknownBallSlot;
+
+    static constexpr uint8 UnknownBallSlot = 0xFF;
+
+    bool operator==(const FMF_PlayerReplicationData &Other) const
+    {
+        return TeamID == Other.TeamID && PlayerID == Other.PlayerID && MatchSlot == Other.MatchSlot && Role == Other.Role && State == Other.State &&
+               bIsSprinting == Other.bIsSprinting && bHasBall == Other.bHasBall && (!bHasBall || BallSlot == Other.BallSlot);
+    }
+
+    bool operator!=(const FMF_PlayerReplicationData &Other) const { return !(*this == Other); }
+
+    bool NetSerialize(FArchive &Ar, UPackageMap *Map, bool &bOutSuccess);
+};
+
+template <>
+struct TStructOpsTypeTraits<FMF_PlayerReplicationData> : public TStructOpsTypeTraitsBase2<FMF_PlayerReplicationData>
+{
+    enum
+    {
+        WithNetSerializer = true,
+        WithIdenticalViaEquality = true
+    };
+};
@@ -57,6 +57,7 @@ Path.Combine(ModulePath, "Base", "UI"),
 "Projects",          // For IPluginManager
 "AIModule",          // AI support
 "NavigationSystem",  // Navigation for AI
+"ReplicationGraph",  // MF_ReplicationGraph (per-connection update rates)
                 }
                 );
 
@@ -4,7 +4,10 @@
 #include "Player/MF_PlayerCharacter.h"
 #include "AIComponent.h"
 #include "Match/MF_Goal.h"
-#include "EngineUtils.h"  // For TActorIterator
+#include "Core/MF_PlayerSnapshotSubsystem.h"
+#include "Match/MF_FieldLandmarks.h"
+#include "AI/MF_LaneClearance.h"
+#include "Ball/MF_Ball.h"
 
 namespace
 {
@@ -134,6 +137,14 @@ FEAIS_ActionResult UMF_EAISActionExecutorComponent::HandleEvaluateShot(const FAI
     const FVector BallVel = BallActor->GetVelocity();
     const float BallSpeed = BallVel.Size();
 
+    // Closed-form flight (gravity, bounces, friction) rather than a straight line at the current velocity
+    const AMF_Ball *Ball = Cast<AMF_Ball>(BallActor);
+    FMF_BallPhysicsState BallState;
+    BallState.Location = BallPos;
+    BallState.Velocity = BallVel;
+    BallState.bIsGrounded = Ball ? Ball->bIsGrounded : true;
+    const FMF_BallTrajectory Trajectory = Ball ? Ball->GetTrajectory() : FMF_BallTrajectory(BallState, MF_Constants::BallRadius);
+
     // Quick reject: not moving fast enough
     if (BallSpeed < ShotSpeedMin)
     {
@@ -152,9 +163,7 @@ FEAIS_ActionResult UMF_EAISActionExecutorComponent::HandleEvaluateShot(const FAI
     ToGoal.Z = 0.0f;
     const FVector ToGoalDir = ToGoal.IsNearlyZero() ? FVector::ZeroVector : ToGoal.GetSafeNormal();
 
-    FVector BallVel2D = BallVel;
-    BallVel2D.Z = 0.0f;
-    const FVector BallDir2D = BallVel2D.IsNearlyZero() ? FVector::ZeroVector : BallVel2D.GetSafeNormal();
+    const FVector &BallDir2D = Trajectory.GetDirection();
 
     const float DotToGoal = FVector::DotProduct(BallDir2D, ToGoalDir);
     const bool bHeadingToGoal = !BallDir2D.IsNearlyZero() && (DotToGoal >= ShotAngleDotMin);
@@ -166,17 +175,18 @@ FEAIS_ActionResult UMF_EAISActionExecutorComponent::HandleEvaluateShot(const FAI
 
     // Approximate goal plane as constant Y at goal location.
     // This is consistent with MiniFootball's field alignment (goals are at +/-Y).
-    const float Vy = BallVel.Y;
-    if (bHeadingToGoal && !FMath::IsNearlyZero(Vy, 1.0f))
+    // A shot that dies before the goal line (-1) is not a threat.
+    if (bHeadingToGoal && !FMath::IsNearlyZero(BallDir2D.Y, 1.0e-3f))
     {
-        const float t = (GoalPos.Y - BallPos.Y) / Vy;
+        const float t = Trajectory.GetTimeAtDistance((GoalPos.Y - BallPos.Y) / BallDir2D.Y);
         if (t > 0.0f)
         {
             TimeToImpact = t;
-            ImpactPoint = BallPos + (BallVel * t);
+            ImpactPoint = Trajectory.GetPosition(t);
 
             const float HalfWidth = GoalHalfWidth + GoalMargin;
-            bShotWide = FMath::Abs(ImpactPoint.X - GoalPos.X) > HalfWidth;
+            bShotWide = FMath::Abs(ImpactPoint.X - GoalPos.X) > HalfWidth ||
+                        ImpactPoint.Z - MF_Constants::BallRadius > MF_Constants::GoalHeight + GoalMargin;
             bShotTowardsGoal = !bShotWide;
         }
     }
@@ -372,21 +382,18 @@ FEAIS_ActionResult UMF_EAISActionExecutorComponent::HandleShoot(const FAIActionP
         // Try to get actor first for smarter aiming
         IEAIS_TargetProvider::Execute_EAIS_GetTargetActor(OwnerCharacter, FName(*Params.Target), TargetActor);
         
+        const FMF_FieldLandmarks &Landmarks = UMF_FieldLandmarksSubsystem::GetLandmarks(OwnerCharacter);
+
         // If it's a Goal, aim for the opening!
-        // We know Goal_Opponent is likely an AMF_Goal
-        if (TargetActor && TargetActor->GetName().Contains(TEXT("Goal")))
+        if (Cast<AMF_Goal>(TargetActor))
         {
              TargetLocation = TargetActor->GetActorLocation();
-             // Goal usually faces X or Y. In our case, Goals are at Y ends.
-             // We generally want to aim for the center of the goal line, maybe with slight offset?
+             // Goals are at the Y ends; aim across the mouth (X).
              // Assuming Goal Actor Location IS the center of the goal line.
              
              // Add slight noise to prevent robotic precision (Horizontal spread)
              float Noise = FMath::RandRange(-200.0f, 200.0f);
-             if (FMath::Abs(TargetLocation.Y) > 5000.0f) // Goal is along Y axis
-             {
-                 TargetLocation.X += Noise;
-             }
+             TargetLocation.X += Noise;
         }
         else if (IEAIS_TargetProvider::Execute_EAIS_GetTargetLocation(OwnerCharacter, FName(*Params.Target), TargetLocation))
         {
@@ -396,10 +403,11 @@ FEAIS_ActionResult UMF_EAISActionExecutorComponent::HandleShoot(const FAIActionP
         if (TargetLocation != FVector::ZeroVector)
         {
             // P_MEIS: Clamp target to field dimensions to prevent shooting OOB
-            // Field dimensions are roughly 4000x10000 (FieldWidth x FieldLength)
-            // Safety clamp: Width +/- 2500, Length +/- 6000
-            TargetLocation.X = FMath::Clamp(TargetLocation.X, -2500.0f, 2500.0f);
-            TargetLocation.Y = FMath::Clamp(TargetLocation.Y, -5500.0f, 5500.0f);
+            // Length gets a little extra so targets inside the goal mouth survive the clamp
+            const float HalfWidth = Landmarks.HalfExtent.X;
+            const float HalfLength = Landmarks.HalfExtent.Y + 250.0f;
+            TargetLocation.X = FMath::Clamp(TargetLocation.X, Landmarks.CenterSpot.X - HalfWidth, Landmarks.CenterSpot.X + HalfWidth);
+            TargetLocation.Y = FMath::Clamp(TargetLocation.Y, Landmarks.CenterSpot.Y - HalfLength, Landmarks.CenterSpot.Y + HalfLength);
 
             Direction = (TargetLocation - OwnerCharacter->GetActorLocation()).GetSafeNormal();
             Result.Message = FString::Printf(TEXT("Shooting at %s"), *Params.Target);
@@ -494,12 +502,22 @@ FEAIS_ActionResult UMF_EAISActionExecutorComponent::HandlePass(const FAIActionPa
             const float BaseSpeed = FMath::Clamp(Dist2D / 0.9f, 600.0f, MF_Constants::BallPassSpeed);
             PassSpeed = FMath::Clamp(BaseSpeed * FMath::Clamp(Power, 0.35f, 1.0f), 600.0f, MF_Constants::BallPassSpeed);
 
-            const float LeadTime = FMath::Clamp(Dist2D / FMath::Max(PassSpeed, 1.0f), 0.12f, 0.30f);
-            FVector AimPoint = TargetLocation + (TargetVel2D * LeadTime);
+            // Lead by the ball's actual travel time to the receiver, from where Kick will launch it
+            // (carry height, airborne until it lands); refine once since leading changes the distance
+            const FVector LaunchLoc = OwnerCharacter->CurrentBall ? OwnerCharacter->CurrentBall->GetActorLocation() : MyLoc;
+            FVector AimPoint = TargetLocation;
+            for (int32 Iteration = 0; Iteration < 2; ++Iteration)
+            {
+                const float LeadTime = MF_BallPhysics::GetPassTime(LaunchLoc, AimPoint, PassSpeed, MF_Constants::BallRadius);
+                AimPoint = TargetLocation + (TargetVel2D * LeadTime);
+            }
 
-            // Clamp aim point to field dimensions
-            AimPoint.X = FMath::Clamp(AimPoint.X, -3200.0f, 3200.0f);
-            AimPoint.Y = FMath::Clamp(AimPoint.Y, -5250.0f, 5250.0f);
+            // Clamp aim point to field dimensions (2m inside the touchlines)
+            const FMF_FieldLandmarks &Landmarks = UMF_FieldLandmarksSubsystem::GetLandmarks(OwnerCharacter);
+            const float HalfWidth = Landmarks.HalfExtent.X - 200.0f;
+            const float HalfLength = Landmarks.HalfExtent.Y;
+            AimPoint.X = FMath::Clamp(AimPoint.X, Landmarks.CenterSpot.X - HalfWidth, Landmarks.CenterSpot.X + HalfWidth);
+            AimPoint.Y = FMath::Clamp(AimPoint.Y, Landmarks.CenterSpot.Y - HalfLength, Landmarks.CenterSpot.Y + HalfLength);
             AimPoint.Z = MyLoc.Z;
 
             Direction = (AimPoint - MyLoc).GetSafeNormal();
@@ -515,13 +533,17 @@ FEAIS_ActionResult UMF_EAISActionExecutorComponent::HandlePass(const FAIActionPa
     if (!bTargetFound)
     {
         FVector MyLoc = OwnerCharacter->GetActorLocation();
-        // If facing towards sideline (>3000 or <-3000)
-        bool bFacingSideline = (MyLoc.X > 2500.0f && Direction.X > 0.0f) || (MyLoc.X < -2500.0f && Direction.X < 0.0f);
+        const FMF_FieldLandmarks &Landmarks = UMF_FieldLandmarksSubsystem::GetLandmarks(OwnerCharacter);
+
+        // If facing towards a sideline from within 9m of it
+        const float SidelineX = Landmarks.HalfExtent.X - 900.0f;
+        const float OffsetX = MyLoc.X - Landmarks.CenterSpot.X;
+        bool bFacingSideline = (OffsetX > SidelineX && Direction.X > 0.0f) || (OffsetX < -SidelineX && Direction.X < 0.0f);
         if (bFacingSideline)
         {
             // Aim towards opponent goal center or at least field center
-            float AttackDir = (OwnerCharacter->GetTeamID() == EMF_TeamID::TeamA) ? -1.0f : 1.0f;
-            FVector SafeTarget(0.0f, 5000.0f * AttackDir, 0.0f);
+            const float AttackDir = Landmarks.GetAttackSign(OwnerCharacter->GetTeamID());
+            FVector SafeTarget(Landmarks.CenterSpot.X, Landmarks.CenterSpot.Y + (Landmarks.HalfExtent.Y - 250.0f) * AttackDir, 0.0f);
             Direction = (SafeTarget - MyLoc).GetSafeNormal();
             Result.Message = TEXT("Passing towards center (safe fallback)");
         }
@@ -711,8 +733,18 @@ FEAIS_ActionResult UMF_EAISActionExecutorComponent::HandleSelectPassTarget(const
         return Result;
     }
 
+    UMF_PlayerSnapshotSubsystem* Snapshots = UMF_PlayerSnapshotSubsystem::Get(OwnerCharacter);
+    if (!Snapshots)
+    {
+        Result.Message = TEXT("No player snapshot");
+        return Result;
+    }
+    const FMF_PlayerSnapshot& Snapshot = Snapshots->GetSnapshot();
+    const int32 MyIndex = Snapshot.IndexOf(OwnerCharacter);
+
     // Find best pass target among teammates
     AMF_PlayerCharacter* BestTarget = nullptr;
+    FVector BestTargetLocation = FVector::ZeroVector;
     float BestScore = -9999.0f;
 
     EMF_TeamID MyTeam = OwnerCharacter->GetTeamID();
@@ -726,36 +758,43 @@ FEAIS_ActionResult UMF_EAISActionExecutorComponent::HandleSelectPassTarget(const
     //   - Distance from GK (not too close, not too far)
     //   - Clear passing lane (no opponents blocking)
 
-    for (TActorIterator<AMF_PlayerCharacter> It(OwnerCharacter->GetWorld()); It; ++It)
+    // Candidate lanes: teammates in passing range (skip self, other team, goalkeepers)
+    TArray<int32, TInlineAllocator<16>> Candidates;
+    TArray<FVector, TInlineAllocator<16>> LaneEnds;
+    for (int32 TeammateIndex = 0; TeammateIndex < Snapshot.Num(); ++TeammateIndex)
     {
-        AMF_PlayerCharacter* Teammate = *It;
-
-        // Skip self, different team, goalkeepers
-        if (!Teammate || Teammate == OwnerCharacter)
+        if (TeammateIndex == MyIndex)
             continue;
-        if (Teammate->GetTeamID() != MyTeam)
+        if (Snapshot.Teams[TeammateIndex] != MyTeam)
             continue;
-        if (Teammate->AIProfile.Contains(TEXT("Goalkeeper")))
+        if (Snapshot.Roles[TeammateIndex] == EMF_PlayerRole::Goalkeeper)
             continue;
 
-        FVector TeammateLocation = Teammate->GetActorLocation();
-        float DistToTeammate = FVector::Dist(MyLocation, TeammateLocation);
-
         // Skip if too close (< 5m) or too far (> 60m)
+        const float DistToTeammate = FVector::Dist(MyLocation, Snapshot.Positions[TeammateIndex]);
         if (DistToTeammate < 500.0f || DistToTeammate > 6000.0f)
             continue;
 
-        // Calculate opponent proximity (safety score)
-        float MinOpponentDist = 9999.0f;
-        for (TActorIterator<AMF_PlayerCharacter> OppIt(OwnerCharacter->GetWorld()); OppIt; ++OppIt)
-        {
-            AMF_PlayerCharacter* Opponent = *OppIt;
-            if (!Opponent || Opponent->GetTeamID() == MyTeam || Opponent->GetTeamID() == EMF_TeamID::None)
-                continue;
+        Candidates.Add(TeammateIndex);
+        LaneEnds.Add(Snapshot.Positions[TeammateIndex]);
+    }
 
-            float OppDist = FVector::Dist(TeammateLocation, Opponent->GetActorLocation());
-            MinOpponentDist = FMath::Min(MinOpponentDist, OppDist);
-        }
+    // One batched pass: receiver marking (safety) and passing lane (is there an opponent in the way?)
+    FMF_LaneOpponents Opponents;
+    Opponents.AddFromSnapshot(Snapshot, MF_TeamMask::AllExcept(MyTeam) & ~MF_TeamMask::Only(EMF_TeamID::None));
+
+    TArray<FMF_LaneClearance, TInlineAllocator<16>> Lanes;
+    Lanes.SetNum(Candidates.Num());
+    MF_LaneClearance::Evaluate(MyLocation, LaneEnds, Opponents, Lanes);
+
+    for (int32 Candidate = 0; Candidate < Candidates.Num(); ++Candidate)
+    {
+        const int32 TeammateIndex = Candidates[Candidate];
+        const FVector TeammateLocation = LaneEnds[Candidate];
+        const float DistToTeammate = FVector::Dist(MyLocation, TeammateLocation);
+
+        const float MinOpponentDist = FMath::Min(Lanes[Candidate].EndClearance, 9999.0f);
+        const bool bLaneBlocked = Lanes[Candidate].IsBlocked(MF_LaneCone::Pass); // Within ~25 degree cone
 
         // Score calculation
         float Score = 0.0f;
@@ -764,17 +803,19 @@ FEAIS_ActionResult UMF_EAISActionExecutorComponent::HandleSelectPassTarget(const
         Score += FMath::Clamp(MinOpponentDist / 500.0f, 0.0f, 10.0f) * 3.0f;
 
         // Role priority for GK distribution (prefer safe players)
-        if (Teammate->AIProfile.Contains(TEXT("Defender")))
+        switch (Snapshot.Roles[TeammateIndex])
         {
+        case EMF_PlayerRole::Defender:
             Score += 20.0f; // Defenders are safest
-        }
-        else if (Teammate->AIProfile.Contains(TEXT("Midfielder")))
-        {
+            break;
+        case EMF_PlayerRole::Midfielder:
             Score += 10.0f; // Midfielders are okay
-        }
-        else if (Teammate->AIProfile.Contains(TEXT("Striker")))
-        {
+            break;
+        case EMF_PlayerRole::Striker:
             Score += 5.0f; // Strikers are risky (long ball)
+            break;
+        default:
+            break;
         }
 
         // Distance penalty: Prefer medium range (20-35m)
@@ -782,30 +823,6 @@ FEAIS_ActionResult UMF_EAISActionExecutorComponent::HandleSelectPassTarget(const
         float DistPenalty = FMath::Abs(DistToTeammate - IdealDist) / 500.0f;
         Score -= DistPenalty * 2.0f;
 
-        // Passing lane check (is there an opponent in the way?)
-        FVector ToTeammate = (TeammateLocation - MyLocation).GetSafeNormal();
-        bool bLaneBlocked = false;
-        for (TActorIterator<AMF_PlayerCharacter> OppIt(OwnerCharacter->GetWorld()); OppIt; ++OppIt)
-        {
-            AMF_PlayerCharacter* Opponent = *OppIt;
-            if (!Opponent || Opponent->GetTeamID() == MyTeam || Opponent->GetTeamID() == EMF_TeamID::None)
-                continue;
-
-            FVector ToOpponent = Opponent->GetActorLocation() - MyLocation;
-            float OpponentDist = ToOpponent.Size();
-
-            // Only check opponents between GK and teammate
-            if (OpponentDist < DistToTeammate)
-            {
-                float DotProduct = FVector::DotProduct(ToTeammate, ToOpponent.GetSafeNormal());
-                if (DotProduct > 0.9f) // Within ~25 degree cone
-                {
-                    bLaneBlocked = true;
-                    break;
-                }
-            }
-        }
-
         if (bLaneBlocked)
         {
             Score -= 15.0f; // Heavy penalty for blocked lane
@@ -815,21 +832,22 @@ FEAIS_ActionResult UMF_EAISActionExecutorComponent::HandleSelectPassTarget(const
         if (Score > BestScore)
         {
             BestScore = Score;
-            BestTarget = Teammate;
+            BestTarget = Snapshot.Characters[TeammateIndex];
+            BestTargetLocation = TeammateLocation;
         }
     }
 
     if (BestTarget)
     {
         // Store target in blackboard for MF.Pass to use
-        AIComp->SetBlackboardVector(TEXT("SelectedPassTargetPosition"), BestTarget->GetActorLocation());
+        AIComp->SetBlackboardVector(TEXT("SelectedPassTargetPosition"), BestTargetLocation);
         AIComp->SetBlackboardBool(TEXT("HasSelectedPassTarget"), true);
 
         Result.bSuccess = true;
         Result.Message = FString::Printf(TEXT("Selected pass target: %s (Score: %.1f)"), *BestTarget->AIProfile, BestScore);
 
         UE_LOG(LogTemp, Log, TEXT("[GK Distribution] Selected target: %s, Role: %s, Score: %.1f, Dist: %.0f"),
-            *BestTarget->GetName(), *BestTarget->AIProfile, BestScore, FVector::Dist(MyLocation, BestTarget->GetActorLocation()));
+            *BestTarget->GetName(), *BestTarget->AIProfile, BestScore, FVector::Dist(MyLocation, BestTargetLocation));
     }
     else
     {
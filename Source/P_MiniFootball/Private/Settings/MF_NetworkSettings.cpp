@@ -0,0 +1,93 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: MF_NetworkSettings - Implementation
+ * @Date: 16/10/2026
+ */
+
+#include "Settings/MF_NetworkSettings.h"
+#include "GameFramework/Actor.h"
+
+float UMF_NetworkSettings::GetDistancePriorityScale(float Distance) const
+{
+    if (Distance <= FullPriorityRadius)
+    {
+        return 1.0f;
+    }
+    if (Distance >= FarPriorityRadius)
+    {
+        return FarPriorityScale;
+    }
+
+    const float Alpha = (Distance - FullPriorityRadius) / (FarPriorityRadius - FullPriorityRadius);
+    return FMath::Lerp(1.0f, FarPriorityScale, Alpha);
+}
+
+uint32 UMF_NetworkSettings::GetReplicationPeriodFrames(float Frequency, float Distance, float ServerTickRate) const
+{
+    const float Rate = Frequency * (bSpatialNetPriority ? GetDistancePriorityScale(Distance) : 1.0f);
+    if (Rate <= UE_KINDA_SMALL_NUMBER)
+    {
+        return MAX_uint16;
+    }
+    return static_cast<uint32>(FMath::Clamp(FMath::RoundToInt32(ServerTickRate / Rate), 1, static_cast<int32>(MAX_uint16)));
+}
+
+const FMF_NetUpdateTier &UMF_NetworkSettings::GetTier(EMF_NetActivity Activity) const
+{
+    switch (Activity)
+    {
+    case EMF_NetActivity::Idle:
+        return IdleTier;
+    case EMF_NetActivity::Hot:
+        return HotTier;
+    default:
+        return ActiveTier;
+    }
+}
+
+EMF_NetActivity UMF_NetworkSettings::ClassifyPlayer(bool bStunned, bool bHasBall, float Speed, float BallDistance) const
+{
+    if (bStunned)
+    {
+        return EMF_NetActivity::Idle;
+    }
+    if (bHasBall || BallDistance <= HotBallRadius)
+    {
+        return EMF_NetActivity::Hot;
+    }
+    return Speed < IdleSpeed ? EMF_NetActivity::Idle : EMF_NetActivity::Active;
+}
+
+EMF_NetActivity UMF_NetworkSettings::ClassifyBall(EMF_BallState State, float Speed) const
+{
+    switch (State)
+    {
+    case EMF_BallState::Possessed:
+    case EMF_BallState::InFlight:
+        return EMF_NetActivity::Hot;
+    case EMF_BallState::Loose:
+        return Speed < IdleSpeed ? EMF_NetActivity::Idle : EMF_NetActivity::Active;
+    default:
+        return EMF_NetActivity::Idle;
+    }
+}
+
+void UMF_NetworkSettings::ApplyNetActivity(AActor &Actor, EMF_NetActivity &InOutActivity, EMF_NetActivity NewActivity) const
+{
+    if (InOutActivity == NewActivity)
+    {
+        return;
+    }
+
+    const bool bBusier = NewActivity > InOutActivity;
+    InOutActivity = NewActivity;
+
+    const FMF_NetUpdateTier &Tier = GetTier(NewActivity);
+    Actor.SetNetUpdateFrequency(Tier.Frequency);
+    Actor.SetMinNetUpdateFrequency(FMath::Min(Tier.MinFrequency, Tier.Frequency));
+
+    if (bBusier)
+    {
+        Actor.ForceNetUpdate();
+    }
+}
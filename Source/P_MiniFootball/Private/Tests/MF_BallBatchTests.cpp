@@ -0,0 +1,180 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Automation tests for FMF_BallBatch (model parity with MF_BallPhysics, per-ball cost benchmark)
+ * @Date: 16/10/2026
+ */
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Math/RandomStream.h"
+#include "HAL/PlatformTime.h"
+
+#include "../../Base/Core/MF_Types.h"
+#include "../../Base/Ball/MF_BallBatch.h"
+#include "../../Base/Ball/MF_BallPhysics.h"
+#include "../../Base/Match/MF_FieldLandmarks.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMF_BallBatchMatchesScalar,
+                                 "P_MiniFootball.Ball.Batch.MatchesScalarModel",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMF_BallBatchMatchesScalar::RunTest(const FString &Parameters)
+{
+    const float StepDt = 1.0f / 120.0f;
+    const float Radius = MF_Constants::BallRadius;
+    const FVector Start(0.0f, 0.0f, MF_Constants::GroundZ + Radius);
+
+    // Ground pass, lofted shot, slow roll that settles quickly
+    const FVector Kicks[] = {
+        FVector(0.0f, MF_Constants::BallPassSpeed, 0.0f),
+        FVector(1500.0f, -2000.0f, 750.0f),
+        FVector(30.0f, 40.0f, 0.0f)};
+
+    FMF_BallBatch Batch;
+    FMF_BallPhysicsState Scalar[UE_ARRAY_COUNT(Kicks)];
+    for (int32 Index = 0; Index < UE_ARRAY_COUNT(Kicks); ++Index)
+    {
+        Batch.Add(Start);
+        Batch.SetVelocity(Index, Kicks[Index]);
+        Scalar[Index].Location = Start;
+        Scalar[Index].Velocity = Kicks[Index];
+        Scalar[Index].bIsGrounded = Kicks[Index].Z <= 0.0f;
+    }
+
+    bool bScalarAtRest[UE_ARRAY_COUNT(Kicks)] = {};
+    for (int32 Step = 0; Step < 10 * 120; ++Step)
+    {
+        Batch.Step(StepDt, Radius);
+        for (int32 Index = 0; Index < UE_ARRAY_COUNT(Kicks); ++Index)
+        {
+            if (!bScalarAtRest[Index])
+            {
+                bScalarAtRest[Index] = MF_BallPhysics::Step(Scalar[Index], StepDt, Radius);
+            }
+        }
+    }
+
+    for (int32 Index = 0; Index < UE_ARRAY_COUNT(Kicks); ++Index)
+    {
+        // Float SoA vs double FVector accumulation
+        TestTrue(FString::Printf(TEXT("Kick %d rest position"), Index), Batch.GetLocation(Index).Equals(Scalar[Index].Location, 0.5f));
+        TestTrue(FString::Printf(TEXT("Kick %d asleep"), Index), Batch.Sleeping[Index] != 0 && bScalarAtRest[Index]);
+    }
+
+    // Boundaries: a ball rolled over the touchline is reported, one in the middle is not
+    const FMF_FieldLandmarks Landmarks;
+    FMF_BallBatch Edge;
+    Edge.Add(FVector(MF_Constants::FieldWidth / 2.0f - 5.0f, 0.0f, Start.Z));
+    Edge.SetVelocity(0, FVector(2400.0f, 0.0f, 0.0f));
+    Edge.Add(Start);
+    Edge.SetVelocity(1, FVector(0.0f, 2400.0f, 0.0f));
+
+    TArray<FMF_BallBatchCrossing> Crossings;
+    Edge.Step(StepDt, Radius);
+    Edge.SweepBoundaries(Landmarks, Radius, Crossings);
+    TestEqual(TEXT("One crossing"), Crossings.Num(), 1);
+    TestTrue(TEXT("Touchline crossing by ball 0"), Crossings.Num() == 1 && Crossings[0].Index == 0 && Crossings[0].Crossing.Type == EMF_BallCrossing::Touchline);
+
+    return true;
+}
+
+/** Nanoseconds per ball per step for Count kicked balls (best of several runs) */
+static double MF_BenchmarkBatch(int32 Count, int32 Steps, const FMF_FieldLandmarks &Landmarks)
+{
+    const float StepDt = 1.0f / 120.0f;
+    const float Radius = MF_Constants::BallRadius;
+    double Best = MAX_dbl;
+
+    for (int32 Run = 0; Run < 5; ++Run)
+    {
+        FRandomStream Random(Count * 31 + Run);
+        FMF_BallBatch Batch;
+        for (int32 Index = 0; Index < Count; ++Index)
+        {
+            const FVector Spot(Random.FRandRange(-3000.0f, 3000.0f), Random.FRandRange(-5000.0f, 5000.0f), MF_Constants::GroundZ + Radius);
+            const FVector Direction = FVector(Random.FRandRange(-1.0f, 1.0f), Random.FRandRange(-1.0f, 1.0f), 0.0f).GetSafeNormal();
+            Batch.Add(Spot);
+            Batch.SetVelocity(Index, Direction * Random.FRandRange(1500.0f, MF_Constants::BallShootSpeed) + FVector(0.0f, 0.0f, Random.FRandRange(0.0f, 600.0f)));
+        }
+
+        TArray<FMF_BallBatchCrossing> Crossings;
+        const double Start = FPlatformTime::Seconds();
+        for (int32 Step = 0; Step < Steps; ++Step)
+        {
+            Batch.Step(StepDt, Radius);
+            Batch.SweepBoundaries(Landmarks, Radius, Crossings);
+            for (const FMF_BallBatchCrossing &Result : Crossings)
+            {
+                // Keep every ball in play so the work per step stays the same
+                Batch.PosX[Result.Index] = Batch.PrevX[Result.Index];
+                Batch.PosY[Result.Index] = Batch.PrevY[Result.Index];
+                Batch.VelX[Result.Index] = -Batch.VelX[Result.Index];
+                Batch.VelY[Result.Index] = -Batch.VelY[Result.Index];
+            }
+        }
+        Best = FMath::Min(Best, (FPlatformTime::Seconds() - Start) * 1e9 / (static_cast<double>(Count) * Steps));
+    }
+    return Best;
+}
+
+/** Same workload through the per-actor path's scalar calls (MF_BallPhysics::Step + SweepBall per ball) */
+static double MF_BenchmarkScalar(int32 Count, int32 Steps, const FMF_FieldLandmarks &Landmarks)
+{
+    const float StepDt = 1.0f / 120.0f;
+    const float Radius = MF_Constants::BallRadius;
+    FRandomStream Random(Count);
+
+    TArray<FMF_BallPhysicsState> States;
+    States.SetNum(Count);
+    for (FMF_BallPhysicsState &State : States)
+    {
+        State.Location = FVector(Random.FRandRange(-3000.0f, 3000.0f), Random.FRandRange(-5000.0f, 5000.0f), MF_Constants::GroundZ + Radius);
+        State.Velocity = FVector(Random.FRandRange(-1.0f, 1.0f), Random.FRandRange(-1.0f, 1.0f), 0.0f).GetSafeNormal() * 2000.0f;
+    }
+
+    const double Start = FPlatformTime::Seconds();
+    for (int32 Step = 0; Step < Steps; ++Step)
+    {
+        for (FMF_BallPhysicsState &State : States)
+        {
+            const FVector From = State.Location;
+            MF_BallPhysics::Step(State, StepDt, Radius);
+            FMF_BallCrossing Crossing;
+            if (Landmarks.SweepBall(From, State.Location, Radius, Crossing))
+            {
+                State.Location = From;
+                State.Velocity = -State.Velocity;
+            }
+        }
+    }
+    return (FPlatformTime::Seconds() - Start) * 1e9 / (static_cast<double>(Count) * Steps);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMF_BallBatchBenchmark,
+                                 "P_MiniFootball.Ball.Batch.PerBallCost",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FMF_BallBatchBenchmark::RunTest(const FString &Parameters)
+{
+    const FMF_FieldLandmarks Landmarks;
+    const int32 Steps = 240;
+    const int32 Counts[] = {8, 32, 128, 512};
+
+    double PerBall[UE_ARRAY_COUNT(Counts)];
+    for (int32 Index = 0; Index < UE_ARRAY_COUNT(Counts); ++Index)
+    {
+        PerBall[Index] = MF_BenchmarkBatch(Counts[Index], Steps, Landmarks);
+        AddInfo(FString::Printf(TEXT("Batch: %4d balls, %.1f ns per ball-step (scalar path %.1f ns)"),
+                                Counts[Index], PerBall[Index], MF_BenchmarkScalar(Counts[Index], Steps, Landmarks)));
+    }
+
+    // Report only: wall-clock ratios depend on the machine and its load, so nothing is asserted here
+    AddInfo(FString::Printf(TEXT("Per-ball cost 512 vs 32 balls: %.2fx"), PerBall[3] / PerBall[1]));
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,61 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Automation tests for FMF_FieldLandmarks::SweepBall (swept goal line / touchline crossing)
+ * @Date: 16/10/2026
+ */
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+
+#include "../../Base/Core/MF_Types.h"
+#include "../../Base/Match/MF_FieldLandmarks.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMF_BallCrossingSweep,
+                                 "P_MiniFootball.Match.BallCrossing.Sweep",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMF_BallCrossingSweep::RunTest(const FString &Parameters)
+{
+    const FMF_FieldLandmarks Landmarks;
+    const float R = MF_Constants::BallRadius;
+    const float HalfLength = MF_Constants::FieldLength / 2.0f;
+    const float HalfWidth = MF_Constants::FieldWidth / 2.0f;
+    const float Z = MF_Constants::GroundZ + R;
+    FMF_BallCrossing Crossing;
+
+    // A 2500cm/s shot at a 10Hz step jumps from in front of the +Y goal to well behind it
+    const FVector ShotFrom(0.0f, HalfLength - 200.0f, Z);
+    const FVector ShotTo(50.0f, HalfLength + 50.0f, Z);
+    TestTrue(TEXT("Fast shot detected"), Landmarks.SweepBall(ShotFrom, ShotTo, R, Crossing));
+    TestTrue(TEXT("Goal"), Crossing.Type == EMF_BallCrossing::Goal);
+    TestTrue(TEXT("TeamA defends +Y"), Crossing.LineTeam == EMF_TeamID::TeamA);
+    TestTrue(TEXT("Crossing when the whole ball is over"), FMath::IsNearlyEqual(static_cast<float>(Crossing.Point.Y), HalfLength + R, 0.01f));
+    TestTrue(TEXT("Fraction"), FMath::IsNearlyEqual(Crossing.Fraction, (200.0f + R) / 250.0f, 1e-4f));
+
+    // Ball on the line (not wholly over) is still in play
+    TestFalse(TEXT("On the line"), Landmarks.SweepBall(ShotFrom, FVector(0.0f, HalfLength, Z), R, Crossing));
+
+    // Wide of the post / over the bar: out over the -Y goal line
+    TestTrue(TEXT("Wide"), Landmarks.SweepBall(FVector(1000.0f, -HalfLength + 100.0f, Z), FVector(1000.0f, -HalfLength - 100.0f, Z), R, Crossing));
+    TestTrue(TEXT("Wide is a goal line crossing"), Crossing.Type == EMF_BallCrossing::GoalLine);
+    TestTrue(TEXT("TeamB defends -Y"), Crossing.LineTeam == EMF_TeamID::TeamB);
+    TestTrue(TEXT("Over the bar"), Landmarks.SweepBall(FVector(0.0f, -HalfLength + 100.0f, 400.0f), FVector(0.0f, -HalfLength - 100.0f, 400.0f), R, Crossing));
+    TestTrue(TEXT("Over the bar is a goal line crossing"), Crossing.Type == EMF_BallCrossing::GoalLine);
+
+    // Touchline, and the earliest of two lines wins in the corner
+    TestTrue(TEXT("Touchline"), Landmarks.SweepBall(FVector(HalfWidth - 50.0f, 0.0f, Z), FVector(HalfWidth + 50.0f, 0.0f, Z), R, Crossing));
+    TestTrue(TEXT("Touchline type"), Crossing.Type == EMF_BallCrossing::Touchline);
+    TestTrue(TEXT("Touchline hit when the ball touches the boards"), FMath::IsNearlyEqual(static_cast<float>(Crossing.Point.X), HalfWidth - R, 0.01f));
+    TestTrue(TEXT("Corner"), Landmarks.SweepBall(FVector(-HalfWidth + 20.0f, HalfLength - 300.0f, Z), FVector(-HalfWidth - 100.0f, HalfLength + 20.0f, Z), R, Crossing));
+    TestTrue(TEXT("Corner crosses the touchline first"), Crossing.Type == EMF_BallCrossing::Touchline);
+
+    // Already over and moving back in: no crossing
+    TestFalse(TEXT("Coming back in"), Landmarks.SweepBall(FVector(HalfWidth + 100.0f, 0.0f, Z), FVector(HalfWidth + 50.0f, 0.0f, Z), R, Crossing));
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,258 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Automation tests for MF_BallPhysics (fixed-step integrator, closed-form trajectory, pass lead)
+ * @Date: 16/10/2026
+ */
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+
+#include "../../Base/Core/MF_Types.h"
+#include "../../Base/Ball/MF_BallPhysics.h"
+
+static FMF_BallPhysicsState MF_MakeKick(const FVector &KickVelocity)
+{
+    FMF_BallPhysicsState State;
+    State.Location = FVector(0.0f, 0.0f, MF_Constants::GroundZ + MF_Constants::BallRadius);
+    State.Velocity = KickVelocity;
+    State.bIsGrounded = KickVelocity.Z <= 0.0f;
+    return State;
+}
+
+/** Reference: step a kicked ball directly (no stepper, no frames) until it rests */
+static FVector MF_StepKickToRest(const FVector &KickVelocity, float StepRate, int32 &OutSteps)
+{
+    FMF_BallPhysicsState State = MF_MakeKick(KickVelocity);
+    const int32 MaxSteps = FMath::CeilToInt32(30.0f * StepRate);
+    for (OutSteps = 1; OutSteps <= MaxSteps; ++OutSteps)
+    {
+        if (MF_BallPhysics::Step(State, 1.0f / StepRate, MF_Constants::BallRadius))
+        {
+            break;
+        }
+    }
+    return State.Location;
+}
+
+/** Run a kicked ball to rest at a given server frame rate; returns the rest position */
+static FVector MF_SimulateKickToRest(const FVector &KickVelocity, float FrameRate, float StepRate, int32 &OutSteps)
+{
+    FMF_BallPhysicsState State = MF_MakeKick(KickVelocity);
+
+    FMF_FixedStepper Stepper;
+    const float StepDt = 1.0f / StepRate;
+    const float FrameDt = 1.0f / FrameRate;
+    OutSteps = 0;
+
+    for (float Time = 0.0f; Time < 30.0f; Time += FrameDt)
+    {
+        const int32 Steps = Stepper.Advance(FrameDt, StepDt, 64);
+        for (int32 Step = 0; Step < Steps; ++Step)
+        {
+            ++OutSteps;
+            if (MF_BallPhysics::Step(State, StepDt, MF_Constants::BallRadius))
+            {
+                return State.Location;
+            }
+        }
+    }
+    return State.Location;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMF_BallPhysicsFrameRateIndependent,
+                                 "P_MiniFootball.Ball.Physics.FrameRateIndependent",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMF_BallPhysicsFrameRateIndependent::RunTest(const FString &Parameters)
+{
+    const float StepRate = 120.0f;
+
+    // Ground pass and a lofted shot (bounces)
+    const FVector Kicks[] = {
+        FVector(0.0f, MF_Constants::BallPassSpeed, 0.0f),
+        FVector(MF_Constants::BallShootSpeed * 0.6f, MF_Constants::BallShootSpeed * 0.8f, MF_Constants::BallShootSpeed * 0.3f)};
+
+    for (const FVector &Kick : Kicks)
+    {
+        // Reference steps the physics directly, so the stepper must neither drop nor add steps
+        int32 ReferenceSteps = 0;
+        const FVector Reference = MF_StepKickToRest(Kick, StepRate, ReferenceSteps);
+
+        for (const float FrameRate : {20.0f, 30.0f, 60.0f, 144.0f})
+        {
+            int32 Steps = 0;
+            const FVector Rest = MF_SimulateKickToRest(Kick, FrameRate, StepRate, Steps);
+            const FString Context = FString::Printf(TEXT("(kick %s at %.0f fps)"), *Kick.ToString(), FrameRate);
+
+            TestEqual(TEXT("Same step count ") + Context, Steps, ReferenceSteps);
+            TestTrue(TEXT("Same rest position ") + Context, Rest.Equals(Reference, 0.01f));
+        }
+    }
+
+    // Ground pass stopping distance matches v^2 / 2a within a step of travel
+    int32 Steps = 0;
+    const FVector PassRest = MF_SimulateKickToRest(FVector(0.0f, MF_Constants::BallPassSpeed, 0.0f), 60.0f, StepRate, Steps);
+    const float Expected = FMath::Square(MF_Constants::BallPassSpeed) / (2.0f * MF_Constants::BallFriction);
+    TestTrue(TEXT("Pass stopping distance"), FMath::IsNearlyEqual(static_cast<float>(PassRest.Y), Expected, MF_Constants::BallPassSpeed / StepRate));
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMF_BallPhysicsStepperClamp,
+                                 "P_MiniFootball.Ball.Physics.StepperClampsHitches",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMF_BallPhysicsStepperClamp::RunTest(const FString &Parameters)
+{
+    const float StepDt = 1.0f / 120.0f;
+    FMF_FixedStepper Stepper;
+
+    TestEqual(TEXT("Half a step runs nothing"), Stepper.Advance(StepDt * 0.5f, StepDt, 8), 0);
+    TestTrue(TEXT("Alpha is one half"), FMath::IsNearlyEqual(Stepper.GetAlpha(StepDt), 0.5f, 1e-3f));
+    TestEqual(TEXT("Remaining half + one step"), Stepper.Advance(StepDt, StepDt, 8), 1);
+
+    // Over many frames the total is floor(elapsed / step), whatever the frame rate
+    for (const float FrameRate : {20.0f, 59.94f, 144.0f})
+    {
+        FMF_FixedStepper FrameStepper;
+        const int32 Frames = 1000;
+        int32 Total = 0;
+        for (int32 Frame = 0; Frame < Frames; ++Frame)
+        {
+            Total += FrameStepper.Advance(1.0f / FrameRate, StepDt, 8);
+        }
+        const double Expected = FMath::FloorToDouble((static_cast<double>(Frames) / FrameRate) * 120.0);
+        TestTrue(FString::Printf(TEXT("Total steps at %.2f fps"), FrameRate), FMath::Abs(Total - Expected) <= 1.0);
+    }
+
+    // One-second hitch is capped and the excess dropped
+    TestEqual(TEXT("Hitch capped"), Stepper.Advance(1.0f, StepDt, 8), 8);
+    TestTrue(TEXT("Excess dropped"), Stepper.Accumulator <= StepDt);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMF_BallTrajectoryMatchesIntegrator,
+                                 "P_MiniFootball.Ball.Physics.TrajectoryMatchesIntegrator",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMF_BallTrajectoryMatchesIntegrator::RunTest(const FString &Parameters)
+{
+    const float StepRate = 240.0f;
+    const float StepDt = 1.0f / StepRate;
+    const float Radius = MF_Constants::BallRadius;
+
+    // Flat pass from the carry height, ground roll, lofted shot
+    FMF_BallPhysicsState Kicks[3];
+    Kicks[0].Location = FVector(0.0f, 0.0f, 110.0f);
+    Kicks[0].Velocity = FVector(0.0f, MF_Constants::BallPassSpeed, 0.0f);
+    Kicks[0].bIsGrounded = false;
+    Kicks[1].Location = FVector(0.0f, 0.0f, MF_Constants::GroundZ + Radius);
+    Kicks[1].Velocity = FVector(-600.0f, 800.0f, 0.0f);
+    Kicks[2].Location = FVector(0.0f, 0.0f, 110.0f);
+    Kicks[2].Velocity = FVector(1500.0f, -2000.0f, 750.0f);
+    Kicks[2].bIsGrounded = false;
+
+    for (int32 KickIndex = 0; KickIndex < UE_ARRAY_COUNT(Kicks); ++KickIndex)
+    {
+        const FMF_BallTrajectory Trajectory(Kicks[KickIndex], Radius);
+        FMF_BallPhysicsState State = Kicks[KickIndex];
+
+        // Allow a few steps of travel plus 1% of the distance covered: the integrator detects
+        // each bounce up to a step late, which shifts when ground friction takes over
+        const float StepTolerance = 4.0f * Kicks[KickIndex].Velocity.Size() * StepDt;
+        auto Tolerance = [&]() { return StepTolerance + 0.01f * FVector::Dist2D(Kicks[KickIndex].Location, State.Location); };
+
+        bool bAtRest = false;
+        int32 Step = 0;
+        while (!bAtRest && Step < 30 * StepRate)
+        {
+            bAtRest = MF_BallPhysics::Step(State, StepDt, Radius);
+            ++Step;
+
+            if (Step % 24 == 0)
+            {
+                const FVector Predicted = Trajectory.GetPosition(Step * StepDt);
+                if (!TestTrue(FString::Printf(TEXT("Kick %d position at %.2fs"), KickIndex, Step * StepDt),
+                              FVector::Dist(Predicted, State.Location) < Tolerance()))
+                {
+                    return false;
+                }
+            }
+        }
+
+        TestTrue(FString::Printf(TEXT("Kick %d stop point"), KickIndex), FVector::Dist(Trajectory.GetStopPoint(), State.Location) < Tolerance());
+        TestTrue(FString::Printf(TEXT("Kick %d stop time"), KickIndex), FMath::IsNearlyEqual(Trajectory.GetStopTime(), Step * StepDt, 0.1f));
+
+        // Time to reach the midpoint of the path lands on that point
+        const FVector Midpoint = FMath::Lerp(Kicks[KickIndex].Location, State.Location, 0.5f);
+        const float MidTime = Trajectory.GetTimeToReach(Midpoint);
+        TestTrue(FString::Printf(TEXT("Kick %d reaches midpoint"), KickIndex), MidTime > 0.0f && MidTime < Trajectory.GetStopTime());
+        TestTrue(FString::Printf(TEXT("Kick %d midpoint time"), KickIndex),
+                 FVector::Dist2D(Trajectory.GetPosition(MidTime), Midpoint) < 1.0f);
+        TestTrue(FString::Printf(TEXT("Kick %d past the stop point"), KickIndex),
+                 Trajectory.GetTimeToReach(State.Location + Trajectory.GetDirection() * 500.0f) < 0.0f);
+    }
+
+    // Landing: a ball dropped from rest lands straight below after sqrt(2h/g)
+    FMF_BallPhysicsState Drop;
+    Drop.Location = FVector(100.0f, 200.0f, 500.0f + Radius);
+    Drop.bIsGrounded = false;
+    const FMF_BallTrajectory DropPath(Drop, Radius);
+    TestTrue(TEXT("Drop landing time"), FMath::IsNearlyEqual(DropPath.GetLandingTime(), FMath::Sqrt(2.0f * 500.0f / MF_Constants::Gravity), 1e-3f));
+    TestTrue(TEXT("Drop landing point"), DropPath.GetLandingPoint().Equals(FVector(100.0f, 200.0f, MF_Constants::GroundZ + Radius), 0.1f));
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMF_BallPassTimeMatchesKick,
+                                 "P_MiniFootball.Ball.Physics.PassTimeMatchesKick",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMF_BallPassTimeMatchesKick::RunTest(const FString &Parameters)
+{
+    const float StepDt = 1.0f / 240.0f;
+    const float Radius = MF_Constants::BallRadius;
+
+    // Passes leave from carry height (PossessionOffset above the actor), as AMF_Ball::Kick launches them
+    const FVector CarryPoint(0.0f, 0.0f, 110.0f);
+
+    struct FPassCase
+    {
+        float Distance;
+        float Power;
+    };
+    const FPassCase Cases[] = {{800.0f, 889.0f}, {1200.0f, MF_Constants::BallPassSpeed}, {2000.0f, MF_Constants::BallPassSpeed}, {1000.0f, 600.0f}};
+
+    for (const FPassCase &Case : Cases)
+    {
+        const FVector Target = CarryPoint + FVector(0.0f, Case.Distance, -CarryPoint.Z);
+        const float Predicted = MF_BallPhysics::GetPassTime(CarryPoint, Target, Case.Power, Radius);
+
+        // Step the real kick until it passes the target (or rests short of it)
+        FMF_BallPhysicsState State = MF_BallPhysics::MakeKick(CarryPoint, FVector(0.0f, 1.0f, 0.0f), Case.Power, false);
+        float Actual = 0.0f;
+        bool bAtRest = false;
+        while (!bAtRest && State.Location.Y < Target.Y && Actual < 30.0f)
+        {
+            bAtRest = MF_BallPhysics::Step(State, StepDt, Radius);
+            Actual += StepDt;
+        }
+
+        // A couple of steps plus 3%: the integrator detects each bounce up to a step late
+        const FString Context = FString::Printf(TEXT("(%.0fcm at %.0fcm/s: predicted %.3fs, stepped %.3fs)"), Case.Distance, Case.Power, Predicted, Actual);
+        TestTrue(TEXT("Pass time ") + Context, FMath::IsNearlyEqual(Predicted, Actual, 2.0f * StepDt + 0.03f * Actual));
+    }
+
+    // Out of reach: the lead falls back to when the ball stops
+    const FVector FarTarget(0.0f, 5000.0f, 0.0f);
+    const FMF_BallTrajectory Path(MF_BallPhysics::MakeKick(CarryPoint, FVector(0.0f, 1.0f, 0.0f), 600.0f, false), Radius);
+    TestEqual(TEXT("Short pass falls back to stop time"), MF_BallPhysics::GetPassTime(CarryPoint, FarTarget, 600.0f, Radius), Path.GetStopTime());
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
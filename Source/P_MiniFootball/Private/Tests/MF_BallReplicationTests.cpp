@@ -0,0 +1,106 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Automation tests for FMF_BallReplicationData::NetSerialize (quantization, wire size)
+ * @Date: 16/10/2026
+ */
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Serialization/BitReader.h"
+#include "Serialization/BitWriter.h"
+
+#include "../../Base/Core/MF_Types.h"
+
+/** Serialize through NetSerialize and back; returns bits written */
+static int64 MF_RoundTrip(FMF_BallReplicationData &Data, FMF_BallReplicationData &OutData)
+{
+    FBitWriter Writer(1024, true);
+    bool bSuccess = false;
+    Data.NetSerialize(Writer, nullptr, bSuccess);
+
+    FBitReader Reader(Writer.GetData(), Writer.GetNumBits());
+    OutData.NetSerialize(Reader, nullptr, bSuccess);
+    return Writer.GetNumBits();
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMF_BallReplicationQuantization,
+                                 "P_MiniFootball.Ball.Replication.Quantization",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMF_BallReplicationQuantization::RunTest(const FString &Parameters)
+{
+    FMF_BallReplicationData Data;
+    Data.Location = FVector(-3123.456f, 5012.789f, 187.25f);
+    Data.Velocity = FVector(1530.2f, -2410.7f, 612.3f);
+    Data.State = EMF_BallState::InFlight;
+    Data.bIsGrounded = false;
+    Data.ServerTimestamp = 1234.5678f;
+
+    FMF_BallReplicationData Received;
+    const int64 Bits = MF_RoundTrip(Data, Received);
+
+    TestTrue(TEXT("Sub-centimetre position"), Received.Location.Equals(Data.Location, 0.2f));
+    TestTrue(TEXT("Velocity within 0.1cm/s"), Received.Velocity.Equals(Data.Velocity, 0.1f));
+    TestEqual(TEXT("Wire size (bits): flags + 3x16 location + 3x16 velocity + 16 timestamp"), Bits, static_cast<int64>(120));
+    TestTrue(TEXT("State"), Received.State == EMF_BallState::InFlight);
+    TestFalse(TEXT("Grounded flag"), Received.bIsGrounded);
+    TestTrue(TEXT("Timestamp unwraps to the millisecond"),
+             FMath::IsNearlyEqual(FMF_BallReplicationData::UnwrapTimestamp(Received.ServerTimestamp, 1234.62f), Data.ServerTimestamp, 1e-3f));
+
+    // Ball at rest stays exactly at rest
+    FMF_BallReplicationData Resting;
+    Resting.Location = FVector(0.0f, 0.0f, MF_Constants::BallRadius);
+    FMF_BallReplicationData RestingReceived;
+    MF_RoundTrip(Resting, RestingReceived);
+    TestTrue(TEXT("Zero velocity is exact"), RestingReceived.Velocity.IsZero());
+
+    // Off the quantized pitch: raw location, still correct
+    FMF_BallReplicationData FarAway = Data;
+    FarAway.Location = FVector(20000.0f, -40000.0f, 50.0f);
+    FMF_BallReplicationData FarReceived;
+    MF_RoundTrip(FarAway, FarReceived);
+    TestTrue(TEXT("Raw location fallback"), FarReceived.Location.Equals(FarAway.Location, 0.01f));
+
+    // Possessor byte only while someone has the ball
+    FMF_BallReplicationData Carried = Data;
+    Carried.State = EMF_BallState::Possessed;
+    Carried.PossessorSlot = 7;
+    FMF_BallReplicationData CarriedReceived;
+    const int64 CarriedBits = MF_RoundTrip(Carried, CarriedReceived);
+    TestEqual(TEXT("Possessor"), static_cast<int32>(CarriedReceived.PossessorSlot), 7);
+    TestEqual(TEXT("Possessor costs one byte"), CarriedBits - Bits, static_cast<int64>(8));
+
+    // Wire size against the per-field layout the default property path sends
+    FBitWriter Unpacked(1024, true);
+    uint8 StateByte = static_cast<uint8>(Data.State);
+    Unpacked << Data.Location << Data.Velocity << StateByte << Data.PossessorSlot << Data.ServerTimestamp << Data.bIsGrounded;
+    AddInfo(FString::Printf(TEXT("Ball update: %lld bytes unpacked, %lld bytes with NetSerialize (%lld while possessed)"),
+                            (Unpacked.GetNumBits() + 7) / 8, (Bits + 7) / 8, (CarriedBits + 7) / 8));
+    TestTrue(TEXT("Packed update is under half the size"), Bits * 2 < Unpacked.GetNumBits());
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMF_BallReplicationTimestampWrap,
+                                 "P_MiniFootball.Ball.Replication.TimestampWrap",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMF_BallReplicationTimestampWrap::RunTest(const FString &Parameters)
+{
+    const float Period = FMF_BallReplicationData::TimestampPeriod;
+
+    // Sent just before a wrap, received just after it
+    const float SentAt = Period * 3.0f - 0.05f;
+    const float Wrapped = FMath::Fmod(SentAt, Period);
+    TestTrue(TEXT("Across the wrap"), FMath::IsNearlyEqual(FMF_BallReplicationData::UnwrapTimestamp(Wrapped, Period * 3.0f + 0.1f), SentAt, 1e-3f));
+
+    // Receiver's clock estimate slightly behind the sender's
+    TestTrue(TEXT("Receiver behind"), FMath::IsNearlyEqual(FMF_BallReplicationData::UnwrapTimestamp(Wrapped, SentAt - 0.2f), SentAt, 1e-3f));
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,139 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Automation tests for MF_LaneClearance (SIMD kernel vs scalar reference)
+ * @Date: 16/10/2026
+ */
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Math/RandomStream.h"
+
+#include "../../Base/Core/MF_Types.h"
+#include "../../Base/AI/MF_LaneClearance.h"
+
+/** Scalar reference using the same definitions as the old per-pair loops */
+static FMF_LaneClearance MF_ReferenceLane(const FVector2D &Origin, const FVector2D &End, const TArray<FVector2D> &Opponents, float RiskRadius)
+{
+    FMF_LaneClearance Result;
+    if (Opponents.Num() == 0)
+    {
+        return Result;
+    }
+
+    const FVector2D Dir = End - Origin;
+    const float LaneLength = Dir.Size();
+    const FVector2D DirNormal = Dir.GetSafeNormal();
+
+    for (const FVector2D &Opponent : Opponents)
+    {
+        const FVector2D ToOpponent = Opponent - Origin;
+        const float Along = FVector2D::DotProduct(ToOpponent, DirNormal);
+
+        const float T = LaneLength > 0.0f ? FMath::Clamp(Along / LaneLength, 0.0f, 1.0f) : 0.0f;
+        const float Clearance = FVector2D::Distance(Opponent, Origin + Dir * T);
+
+        Result.MinClearance = FMath::Min(Result.MinClearance, Clearance);
+        Result.EndClearance = FMath::Min(Result.EndClearance, static_cast<float>(FVector2D::Distance(Opponent, End)));
+        Result.InterceptRisk += FMath::Max(0.0f, 1.0f - Clearance / RiskRadius);
+
+        if (Along > 0.0f && ToOpponent.Size() < LaneLength)
+        {
+            const float Perp = FMath::Abs(FVector2D::CrossProduct(ToOpponent, DirNormal));
+            Result.MinAngularClearance = FMath::Min(Result.MinAngularClearance, Perp / Along);
+        }
+    }
+    return Result;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMF_LaneClearanceMatchesReference,
+                                 "P_MiniFootball.AI.LaneClearance.MatchesScalarReference",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMF_LaneClearanceMatchesReference::RunTest(const FString &Parameters)
+{
+    FRandomStream Stream(4321);
+    const float HalfX = MF_Constants::FieldWidth / 2.0f;
+    const float HalfY = MF_Constants::FieldLength / 2.0f;
+    const float RiskRadius = MF_LaneClearance::DefaultRiskRadius;
+
+    // Counts that do and do not fill whole registers
+    for (const int32 OpponentCount : {0, 1, 3, 4, 7, 11})
+    {
+        FMF_LaneOpponents Opponents;
+        TArray<FVector2D> Reference;
+        for (int32 Index = 0; Index < OpponentCount; ++Index)
+        {
+            const FVector2D Position(Stream.FRandRange(-HalfX, HalfX), Stream.FRandRange(-HalfY, HalfY));
+            Opponents.Add(FVector(Position.X, Position.Y, 90.0f));
+            Reference.Add(Position);
+        }
+        TestEqual(TEXT("Opponent count"), Opponents.Num(), OpponentCount);
+        TestTrue(TEXT("Padded to a multiple of 4"), Opponents.NumPadded() % 4 == 0);
+
+        const FVector Origin(Stream.FRandRange(-HalfX, HalfX), Stream.FRandRange(-HalfY, HalfY), 90.0f);
+        TArray<FVector> LaneEnds;
+        for (int32 Lane = 0; Lane < 10; ++Lane)
+        {
+            LaneEnds.Add(FVector(Stream.FRandRange(-HalfX, HalfX), Stream.FRandRange(-HalfY, HalfY), 90.0f));
+        }
+
+        TArray<FMF_LaneClearance> Results;
+        Results.SetNum(LaneEnds.Num());
+        MF_LaneClearance::Evaluate(Origin, LaneEnds, Opponents, Results, RiskRadius);
+
+        for (int32 Lane = 0; Lane < LaneEnds.Num(); ++Lane)
+        {
+            const FMF_LaneClearance Expected = MF_ReferenceLane(FVector2D(Origin), FVector2D(LaneEnds[Lane]), Reference, RiskRadius);
+            const FMF_LaneClearance &Actual = Results[Lane];
+            const FString Context = FString::Printf(TEXT("(opponents %d, lane %d)"), OpponentCount, Lane);
+
+            if (!TestTrue(TEXT("MinClearance ") + Context, FMath::IsNearlyEqual(Actual.MinClearance, Expected.MinClearance, 0.5f)) ||
+                !TestTrue(TEXT("EndClearance ") + Context, FMath::IsNearlyEqual(Actual.EndClearance, Expected.EndClearance, 0.5f)) ||
+                !TestTrue(TEXT("InterceptRisk ") + Context, FMath::IsNearlyEqual(Actual.InterceptRisk, Expected.InterceptRisk, 0.01f)) ||
+                !TestEqual(TEXT("Pass blocked ") + Context, Actual.IsBlocked(MF_LaneCone::Pass), Expected.IsBlocked(MF_LaneCone::Pass)) ||
+                !TestEqual(TEXT("Shot blocked ") + Context, Actual.IsBlocked(MF_LaneCone::Shot), Expected.IsBlocked(MF_LaneCone::Shot)))
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMF_LaneClearanceCone,
+                                 "P_MiniFootball.AI.LaneClearance.ConeMatchesDotThreshold",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMF_LaneClearanceCone::RunTest(const FString &Parameters)
+{
+    // Lane along +Y, 2000cm long; opponent 1000cm out at varying angles
+    const FVector Origin(0.0f, 0.0f, 0.0f);
+    const FVector End(0.0f, 2000.0f, 0.0f);
+
+    for (float Degrees = 0.0f; Degrees <= 60.0f; Degrees += 1.0f)
+    {
+        const float Radians = FMath::DegreesToRadians(Degrees);
+        FMF_LaneOpponents Opponents;
+        Opponents.Add(FVector(FMath::Sin(Radians) * 1000.0f, FMath::Cos(Radians) * 1000.0f, 0.0f));
+
+        const FMF_LaneClearance Lane = MF_LaneClearance::EvaluateLane(Origin, End, Opponents);
+        const float Dot = FMath::Cos(Radians);
+
+        TestEqual(FString::Printf(TEXT("Pass cone at %.0f deg"), Degrees), Lane.IsBlocked(MF_LaneCone::Pass), Dot > 0.9f);
+        TestEqual(FString::Printf(TEXT("Shot cone at %.0f deg"), Degrees), Lane.IsBlocked(MF_LaneCone::Shot), Dot > 0.85f);
+    }
+
+    // Opponent behind the origin or beyond the lane end never blocks
+    FMF_LaneOpponents Behind;
+    Behind.Add(FVector(0.0f, -500.0f, 0.0f));
+    Behind.Add(FVector(0.0f, 2500.0f, 0.0f));
+    TestFalse(TEXT("Behind / beyond does not block"), MF_LaneClearance::EvaluateLane(Origin, End, Behind).IsBlocked(MF_LaneCone::Pass));
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,97 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Automation tests for UMF_NetworkSettings (distance priority falloff, replication periods, activity tiers)
+ * @Date: 16/10/2026
+ */
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+
+#include "../../Public/Settings/MF_NetworkSettings.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMF_NetworkSettingsDistancePriority,
+                                 "P_MiniFootball.Network.Settings.DistancePriorityScale",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMF_NetworkSettingsDistancePriority::RunTest(const FString &Parameters)
+{
+    // Transient copy so the project's configured values don't leak in
+    UMF_NetworkSettings *Settings = NewObject<UMF_NetworkSettings>();
+    Settings->FullPriorityRadius = 1000.0f;
+    Settings->FarPriorityRadius = 3000.0f;
+    Settings->FarPriorityScale = 0.2f;
+
+    TestEqual(TEXT("Inside full radius"), Settings->GetDistancePriorityScale(0.0f), 1.0f);
+    TestEqual(TEXT("At full radius"), Settings->GetDistancePriorityScale(1000.0f), 1.0f);
+    TestEqual(TEXT("Halfway"), Settings->GetDistancePriorityScale(2000.0f), 0.6f, KINDA_SMALL_NUMBER);
+    TestEqual(TEXT("At far radius"), Settings->GetDistancePriorityScale(3000.0f), 0.2f);
+    TestEqual(TEXT("Beyond far radius"), Settings->GetDistancePriorityScale(50000.0f), 0.2f);
+
+    // Degenerate band (far <= full) is a step, not a divide by zero
+    Settings->FarPriorityRadius = 1000.0f;
+    TestEqual(TEXT("Step just past the radius"), Settings->GetDistancePriorityScale(1000.5f), 0.2f);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMF_NetworkSettingsReplicationPeriod,
+                                 "P_MiniFootball.Network.Settings.ReplicationPeriodFrames",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMF_NetworkSettingsReplicationPeriod::RunTest(const FString &Parameters)
+{
+    UMF_NetworkSettings *Settings = NewObject<UMF_NetworkSettings>();
+    Settings->FullPriorityRadius = 1000.0f;
+    Settings->FarPriorityRadius = 3000.0f;
+    Settings->FarPriorityScale = 0.25f;
+
+    // 60 Hz server
+    TestEqual(TEXT("Hot tier up close sends every frame"), static_cast<int32>(Settings->GetReplicationPeriodFrames(60.0f, 500.0f, 60.0f)), 1);
+    TestEqual(TEXT("Hot tier far away sends every 4th frame"), static_cast<int32>(Settings->GetReplicationPeriodFrames(60.0f, 5000.0f, 60.0f)), 4);
+    TestEqual(TEXT("Active tier far away"), static_cast<int32>(Settings->GetReplicationPeriodFrames(30.0f, 5000.0f, 60.0f)), 8);
+    TestEqual(TEXT("Idle tier far away"), static_cast<int32>(Settings->GetReplicationPeriodFrames(4.0f, 5000.0f, 60.0f)), 60);
+    TestEqual(TEXT("Faster than the server ticks"), static_cast<int32>(Settings->GetReplicationPeriodFrames(120.0f, 0.0f, 60.0f)), 1);
+    TestEqual(TEXT("Zero frequency is capped"), static_cast<int32>(Settings->GetReplicationPeriodFrames(0.0f, 0.0f, 60.0f)), static_cast<int32>(MAX_uint16));
+
+    // Spatial falloff off: tier rate only
+    Settings->bSpatialNetPriority = false;
+    TestEqual(TEXT("No falloff when disabled"), static_cast<int32>(Settings->GetReplicationPeriodFrames(60.0f, 5000.0f, 60.0f)), 1);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMF_NetworkSettingsActivityTiers,
+                                 "P_MiniFootball.Network.Settings.ActivityTiers",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMF_NetworkSettingsActivityTiers::RunTest(const FString &Parameters)
+{
+    UMF_NetworkSettings *Settings = NewObject<UMF_NetworkSettings>();
+    Settings->HotBallRadius = 1000.0f;
+    Settings->IdleSpeed = 10.0f;
+
+    // Players: stunned beats everything, then carrier / near ball, then speed
+    TestTrue(TEXT("Stunned next to the ball"), Settings->ClassifyPlayer(true, false, 0.0f, 100.0f) == EMF_NetActivity::Idle);
+    TestTrue(TEXT("Carrier standing still"), Settings->ClassifyPlayer(false, true, 0.0f, 0.0f) == EMF_NetActivity::Hot);
+    TestTrue(TEXT("Near the ball"), Settings->ClassifyPlayer(false, false, 0.0f, 999.0f) == EMF_NetActivity::Hot);
+    TestTrue(TEXT("Running far from the ball"), Settings->ClassifyPlayer(false, false, 600.0f, 5000.0f) == EMF_NetActivity::Active);
+    TestTrue(TEXT("Standing far from the ball"), Settings->ClassifyPlayer(false, false, 5.0f, 5000.0f) == EMF_NetActivity::Idle);
+    TestTrue(TEXT("No ball"), Settings->ClassifyPlayer(false, false, 600.0f, MAX_flt) == EMF_NetActivity::Active);
+
+    // Ball
+    TestTrue(TEXT("Ball in flight"), Settings->ClassifyBall(EMF_BallState::InFlight, 2000.0f) == EMF_NetActivity::Hot);
+    TestTrue(TEXT("Ball possessed"), Settings->ClassifyBall(EMF_BallState::Possessed, 0.0f) == EMF_NetActivity::Hot);
+    TestTrue(TEXT("Ball rolling"), Settings->ClassifyBall(EMF_BallState::Loose, 300.0f) == EMF_NetActivity::Active);
+    TestTrue(TEXT("Ball resting"), Settings->ClassifyBall(EMF_BallState::Loose, 0.0f) == EMF_NetActivity::Idle);
+    TestTrue(TEXT("Ball out of bounds"), Settings->ClassifyBall(EMF_BallState::OutOfBounds, 0.0f) == EMF_NetActivity::Idle);
+
+    // Unclassified actors use the Active tier
+    TestEqual(TEXT("None uses Active tier"), Settings->GetTier(EMF_NetActivity::None).Frequency, Settings->ActiveTier.Frequency);
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,65 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Automation tests for the FMF_PitchZoneMap built from default field landmarks
+ * @Date: 16/10/2026
+ */
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+
+#include "../../Base/Core/MF_Types.h"
+#include "../../Base/Match/MF_FieldLandmarks.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMF_PitchZoneDefaults,
+                                 "P_MiniFootball.Match.PitchZones.DefaultLayout",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMF_PitchZoneDefaults::RunTest(const FString &Parameters)
+{
+    const FMF_FieldLandmarks Landmarks;
+    const float HalfLength = MF_Constants::FieldLength / 2.0f;
+    const float HalfWidth = MF_Constants::FieldWidth / 2.0f;
+    const EMF_TeamID A = EMF_TeamID::TeamA;
+    const EMF_TeamID B = EMF_TeamID::TeamB;
+
+    auto Has = [&Landmarks](EMF_TeamID Team, const FVector &Location, EMF_PitchZone Zone)
+    {
+        return EnumHasAnyFlags(Landmarks.GetZones(Team, Location), Zone);
+    };
+
+    // Centre spot: middle third for both teams, not in any box
+    const FVector Center(0.0f, 0.0f, MF_Constants::GroundZ);
+    TestTrue(TEXT("Centre is middle third (A)"), Has(A, Center, EMF_PitchZone::MiddleThird));
+    TestTrue(TEXT("Centre is middle third (B)"), Has(B, Center, EMF_PitchZone::MiddleThird));
+    TestFalse(TEXT("Centre is in no box"), Has(A, Center, EMF_PitchZone::OwnBox | EMF_PitchZone::OpponentBox));
+
+    // Penalty spot near +Y: TeamA defends it
+    const FVector PenaltySpotA(0.0f, HalfLength - 1100.0f, MF_Constants::GroundZ);
+    TestTrue(TEXT("A own box"), Has(A, PenaltySpotA, EMF_PitchZone::OwnBox));
+    TestTrue(TEXT("B opponent box"), Has(B, PenaltySpotA, EMF_PitchZone::OpponentBox));
+    TestTrue(TEXT("A defensive third"), Has(A, PenaltySpotA, EMF_PitchZone::DefensiveThird));
+    TestTrue(TEXT("B attacking third"), Has(B, PenaltySpotA, EMF_PitchZone::AttackingThird));
+    TestFalse(TEXT("Penalty spot is outside the goal area"), Has(A, PenaltySpotA, EMF_PitchZone::OwnGoalArea));
+
+    // Six-yard box in front of the -Y goal
+    const FVector GoalAreaB(0.0f, -HalfLength + 200.0f, MF_Constants::GroundZ);
+    TestTrue(TEXT("B own goal area"), Has(B, GoalAreaB, EMF_PitchZone::OwnGoalArea | EMF_PitchZone::OwnBox));
+    TestTrue(TEXT("A opponent goal area"), Has(A, GoalAreaB, EMF_PitchZone::OpponentGoalArea));
+
+    // Flank: wider than the box, not inside it
+    const FVector Wing(HalfWidth - 300.0f, HalfLength - 500.0f, MF_Constants::GroundZ);
+    TestTrue(TEXT("Wing is a flank"), Has(A, Wing, EMF_PitchZone::Flank));
+    TestFalse(TEXT("Wing is outside the box"), Has(A, Wing, EMF_PitchZone::OwnBox));
+
+    // Off the pitch clamps to the edge cell; None team has no zones
+    TestTrue(TEXT("Behind the goal line clamps to the defensive third"),
+             Has(A, FVector(0.0f, HalfLength + 2000.0f, 0.0f), EMF_PitchZone::DefensiveThird));
+    TestTrue(TEXT("No team, no zones"), Landmarks.GetZones(EMF_TeamID::None, Center) == EMF_PitchZone::None);
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,69 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Automation tests for FMF_PlayerReplicationData::NetSerialize (round trip, wire size)
+ * @Date: 16/10/2026
+ */
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Serialization/BitReader.h"
+#include "Serialization/BitWriter.h"
+
+#include "../../Base/Player/MF_PlayerReplicationData.h"
+
+/** Serialize through NetSerialize and back; returns bits written */
+static int64 MF_RoundTrip(FMF_PlayerReplicationData &Data, FMF_PlayerReplicationData &OutData)
+{
+    FBitWriter Writer(256, true);
+    bool bSuccess = false;
+    Data.NetSerialize(Writer, nullptr, bSuccess);
+
+    FBitReader Reader(Writer.GetData(), Writer.GetNumBits());
+    OutData.NetSerialize(Reader, nullptr, bSuccess);
+    return Writer.GetNumBits();
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMF_PlayerReplicationRoundTrip,
+                                 "P_MiniFootball.Player.Replication.RoundTrip",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMF_PlayerReplicationRoundTrip::RunTest(const FString &Parameters)
+{
+    // Largest value of every packed field
+    FMF_PlayerReplicationData Data;
+    Data.TeamID = EMF_TeamID::TeamB;
+    Data.PlayerID = 10;
+    Data.MatchSlot = 21;
+    Data.Role = EMF_PlayerRole::None;
+    Data.State = EMF_PlayerState::Stunned;
+    Data.bIsSprinting = true;
+    Data.bHasBall = true;
+    Data.BallSlot = 0;
+
+    FMF_PlayerReplicationData Received;
+    const int64 CarrierBits = MF_RoundTrip(Data, Received);
+    TestTrue(TEXT("Carrier round trip"), Received == Data);
+    TestEqual(TEXT("Carrier wire size (bits)"), CarrierBits, 34LL);
+
+    // Without the ball the slot byte is not sent
+    Data.TeamID = EMF_TeamID::TeamA;
+    Data.Role = EMF_PlayerRole::Goalkeeper;
+    Data.State = EMF_PlayerState::Idle;
+    Data.bIsSprinting = false;
+    Data.bHasBall = false;
+
+    const int64 Bits = MF_RoundTrip(Data, Received);
+    TestTrue(TEXT("Round trip without ball"), Received == Data);
+    TestEqual(TEXT("Wire size without ball (bits)"), Bits, 26LL);
+
+    // Role survives as the stock profile name clients rebuild
+    TestTrue(TEXT("Role to profile and back"),
+             MF_Roles::FromProfileName(MF_Roles::ToProfileName(EMF_PlayerRole::Midfielder)) == EMF_PlayerRole::Midfielder);
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,146 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Automation tests for MF_SpatialGrid (radius + nearest queries vs brute force)
+ * @Date: 16/10/2026
+ */
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Math/RandomStream.h"
+
+#include "../../Base/Core/MF_SpatialGrid.h"
+
+static void MF_BuildRandomGridPoints(FRandomStream &Stream, int32 Count, TArray<FVector> &OutPositions, TArray<EMF_TeamID> &OutTeams)
+{
+    // Spread slightly past the touchlines so edge-cell clamping is exercised
+    const float HalfX = MF_Constants::FieldWidth / 2.0f + 800.0f;
+    const float HalfY = MF_Constants::FieldLength / 2.0f + 800.0f;
+
+    OutPositions.Reset();
+    OutTeams.Reset();
+    for (int32 Index = 0; Index < Count; ++Index)
+    {
+        OutPositions.Add(FVector(Stream.FRandRange(-HalfX, HalfX), Stream.FRandRange(-HalfY, HalfY), Stream.FRandRange(0.0f, 120.0f)));
+        OutTeams.Add(static_cast<EMF_TeamID>(Stream.RandRange(0, 2)));
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMF_SpatialGridQueryRadius,
+                                 "P_MiniFootball.Core.SpatialGrid.QueryRadiusMatchesBruteForce",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMF_SpatialGridQueryRadius::RunTest(const FString &Parameters)
+{
+    FRandomStream Stream(1234);
+    TArray<FVector> Positions;
+    TArray<EMF_TeamID> Teams;
+    MF_BuildRandomGridPoints(Stream, 200, Positions, Teams);
+
+    FMF_SpatialGrid Grid;
+    Grid.InitializeForField();
+    Grid.Build(Positions, Teams);
+    TestEqual(TEXT("Grid item count"), Grid.Num(), Positions.Num());
+
+    const float Radii[] = {MF_Constants::BallPickupRadius, MF_Constants::TackleRange, 250.0f, 1200.0f};
+    const uint8 Masks[] = {MF_TeamMask::All, MF_TeamMask::Only(EMF_TeamID::TeamA), MF_TeamMask::AllExcept(EMF_TeamID::TeamB)};
+
+    TArray<int32> GridResult;
+    for (int32 Query = 0; Query < 100; ++Query)
+    {
+        const int32 Exclude = Query % Positions.Num();
+        const FVector Center = Positions[Exclude] + FVector(Stream.FRandRange(-100.0f, 100.0f), Stream.FRandRange(-100.0f, 100.0f), 0.0f);
+
+        for (const float Radius : Radii)
+        {
+            for (const uint8 Mask : Masks)
+            {
+                TArray<int32> Expected;
+                for (int32 Index = 0; Index < Positions.Num(); ++Index)
+                {
+                    const bool bTeamOk = (Mask & MF_TeamMask::Only(Teams[Index])) != 0;
+                    if (Index != Exclude && bTeamOk && FVector::Dist(Center, Positions[Index]) <= Radius)
+                    {
+                        Expected.Add(Index);
+                    }
+                }
+
+                Grid.QueryRadius(Center, Radius, Mask, GridResult, Exclude);
+                GridResult.Sort();
+
+                if (!TestTrue(FString::Printf(TEXT("Query %d radius %.0f mask %d matches brute force"), Query, Radius, Mask), GridResult == Expected))
+                {
+                    return false;
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMF_SpatialGridFindNearest,
+                                 "P_MiniFootball.Core.SpatialGrid.FindNearestMatchesBruteForce",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMF_SpatialGridFindNearest::RunTest(const FString &Parameters)
+{
+    FRandomStream Stream(5678);
+    TArray<FVector> Positions;
+    TArray<EMF_TeamID> Teams;
+
+    FMF_SpatialGrid Grid;
+    Grid.InitializeForField();
+
+    // Sparse and dense populations (sparse forces wide ring searches)
+    for (const int32 Count : {3, 22, 150})
+    {
+        MF_BuildRandomGridPoints(Stream, Count, Positions, Teams);
+        Grid.Build(Positions, Teams);
+
+        for (int32 Query = 0; Query < 100; ++Query)
+        {
+            const FVector Probe(Stream.FRandRange(-4500.0f, 4500.0f), Stream.FRandRange(-6000.0f, 6000.0f), 90.0f);
+            const EMF_TeamID MyTeam = static_cast<EMF_TeamID>(Stream.RandRange(0, 2));
+            const uint8 Mask = MF_TeamMask::AllExcept(MyTeam);
+
+            float ExpectedDist = TNumericLimits<float>::Max();
+            for (int32 Index = 0; Index < Positions.Num(); ++Index)
+            {
+                if (Teams[Index] != MyTeam)
+                {
+                    ExpectedDist = FMath::Min(ExpectedDist, static_cast<float>(FVector::Dist(Probe, Positions[Index])));
+                }
+            }
+
+            float GridDist = 0.0f;
+            const int32 Found = Grid.FindNearest(Probe, Mask, INDEX_NONE, TNumericLimits<float>::Max(), &GridDist);
+
+            if (ExpectedDist == TNumericLimits<float>::Max())
+            {
+                TestEqual(TEXT("No candidate -> INDEX_NONE"), Found, (int32)INDEX_NONE);
+                continue;
+            }
+
+            if (!TestTrue(TEXT("Nearest found"), Found != INDEX_NONE) ||
+                !TestTrue(FString::Printf(TEXT("Nearest distance (count %d, query %d)"), Count, Query), FMath::IsNearlyEqual(GridDist, ExpectedDist, 0.01f)))
+            {
+                return false;
+            }
+            TestTrue(TEXT("Nearest respects team mask"), Teams[Found] != MyTeam);
+        }
+    }
+
+    // Max radius cut-off
+    Positions = {FVector(0.0f, 0.0f, 0.0f)};
+    Teams = {EMF_TeamID::TeamB};
+    Grid.Build(Positions, Teams);
+    TestEqual(TEXT("Out of MaxRadius -> INDEX_NONE"), Grid.FindNearest(FVector(1000.0f, 0.0f, 0.0f), MF_TeamMask::All, INDEX_NONE, 500.0f), (int32)INDEX_NONE);
+    TestEqual(TEXT("Within MaxRadius -> found"), Grid.FindNearest(FVector(400.0f, 0.0f, 0.0f), MF_TeamMask::All, INDEX_NONE, 500.0f), 0);
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,135 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: MF_NetworkSettings - Per-deployment replication policy (spatial net priority, adaptive update rates)
+ * @Date: 16/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DeveloperSettings.h"
+#include "Core/MF_Types.h"
+#include "MF_NetworkSettings.generated.h"
+
+/** Net update rates and priority for one activity tier */
+USTRUCT()
+struct P_MINIFOOTBALL_API FMF_NetUpdateTier
+{
+    GENERATED_BODY()
+
+    FMF_NetUpdateTier() = default;
+    FMF_NetUpdateTier(float InFrequency, float InMinFrequency, float InPriorityScale)
+        : Frequency(InFrequency), MinFrequency(InMinFrequency), PriorityScale(InPriorityScale)
+    {
+    }
+
+    /** Target updates per second */
+    UPROPERTY(Config, EditAnywhere, Category = "Network", meta = (ClampMin = "0.1"))
+    float Frequency = MF_Constants::NetUpdateFrequency;
+
+    /** Floor the engine's adaptive update frequency may back off to while nothing changes */
+    UPROPERTY(Config, EditAnywhere, Category = "Network", meta = (ClampMin = "0.1"))
+    float MinFrequency = MF_Constants::MinNetUpdateFrequency;
+
+    /** Net priority multiplier while in this tier */
+    UPROPERTY(Config, EditAnywhere, Category = "Network", meta = (ClampMin = "0.01"))
+    float PriorityScale = 1.0f;
+};
+
+/**
+ * Project-configurable replication policy.
+ *
+ * Characters are weighted per connection by distance to that viewer's focus (its view target,
+ * e.g. the possessed character or the AMF_Spectator camera) and to the ball; the nearer of the two wins.
+ * Under UMF_ReplicationGraph the weight cuts the character's update rate for that connection
+ * (GetReplicationPeriodFrames). On the default net driver it only scales net priority, which decides
+ * send order when a connection is saturated and cannot lower the rate of an unsaturated one.
+ *
+ * Characters and the ball also pick an update-rate tier from what they are doing (EMF_NetActivity),
+ * re-evaluated every server tick: idle or stunned players and a resting ball drop to a few Hz,
+ * the carrier, players near the ball and a ball in flight get the highest rate and priority.
+ * Configure via Project Settings or DefaultGame.ini.
+ */
+UCLASS(Config = Game, DefaultConfig, meta = (DisplayName = "MiniFootball Network"))
+class P_MINIFOOTBALL_API UMF_NetworkSettings : public UDeveloperSettings
+{
+    GENERATED_BODY()
+
+public:
+    /** Settings object (class default) */
+    static const UMF_NetworkSettings *Get() { return GetDefault<UMF_NetworkSettings>(); }
+
+    // Relevancy & Priority
+
+    /** Scale character update rate (replication graph) or net priority by distance to the viewer's focus and to the ball. Off = engine default. */
+    UPROPERTY(Config, EditAnywhere, Category = "Network|Priority")
+    bool bSpatialNetPriority = true;
+
+    /** Players within this distance (cm, 2D) of the viewer's focus or the ball keep full priority */
+    UPROPERTY(Config, EditAnywhere, Category = "Network|Priority", meta = (ClampMin = "0.0", Units = "cm"))
+    float FullPriorityRadius = 2000.0f;
+
+    /** Beyond this distance (cm, 2D) players drop to FarPriorityScale; linear in between */
+    UPROPERTY(Config, EditAnywhere, Category = "Network|Priority", meta = (ClampMin = "0.0", Units = "cm"))
+    float FarPriorityRadius = 6000.0f;
+
+    /** Update rate (replication graph) or priority multiplier for players beyond FarPriorityRadius (1 = no falloff) */
+    UPROPERTY(Config, EditAnywhere, Category = "Network|Priority", meta = (ClampMin = "0.01", ClampMax = "1.0"))
+    float FarPriorityScale = 0.25f;
+
+    /** Priority multiplier for the match ball (every viewer needs it first) */
+    UPROPERTY(Config, EditAnywhere, Category = "Network|Priority", meta = (ClampMin = "1.0"))
+    float BallPriorityScale = 2.0f;
+
+    // Adaptive Update Rate
+
+    /** Switch characters and the ball between the tiers below. Off = fixed MF_Constants rates. */
+    UPROPERTY(Config, EditAnywhere, Category = "Network|Update Rate")
+    bool bAdaptiveNetUpdateFrequency = true;
+
+    /** Carrier and players near the ball; ball possessed or in flight */
+    UPROPERTY(Config, EditAnywhere, Category = "Network|Update Rate")
+    FMF_NetUpdateTier HotTier = {MF_Constants::NetUpdateFrequency, MF_Constants::MinNetUpdateFrequency, 1.5f};
+
+    /** Moving players away from the ball; ball rolling loose */
+    UPROPERTY(Config, EditAnywhere, Category = "Network|Update Rate")
+    FMF_NetUpdateTier ActiveTier = {30.0f, 15.0f, 1.0f};
+
+    /** Standing or stunned players; ball at rest or out of bounds */
+    UPROPERTY(Config, EditAnywhere, Category = "Network|Update Rate")
+    FMF_NetUpdateTier IdleTier = {4.0f, 2.0f, 0.5f};
+
+    /** Players within this distance (cm, 2D) of the ball are Hot */
+    UPROPERTY(Config, EditAnywhere, Category = "Network|Update Rate", meta = (ClampMin = "0.0", Units = "cm"))
+    float HotBallRadius = 1000.0f;
+
+    /** Players and balls slower than this (cm/s, 2D) count as standing still */
+    UPROPERTY(Config, EditAnywhere, Category = "Network|Update Rate", meta = (ClampMin = "0.0", Units = "CentimetersPerSecond"))
+    float IdleSpeed = 10.0f;
+
+    /** Priority multiplier for a player at Distance (cm) from a point of interest: 1 up close, FarPriorityScale far away */
+    float GetDistancePriorityScale(float Distance) const;
+
+    /** Server frames between sends of an actor updating at Frequency (Hz) for a viewer Distance (cm) away (at least 1) */
+    uint32 GetReplicationPeriodFrames(float Frequency, float Distance, float ServerTickRate) const;
+
+    /** Tier for an activity (None uses ActiveTier) */
+    const FMF_NetUpdateTier &GetTier(EMF_NetActivity Activity) const;
+
+    /** Activity of a player (BallDistance is 2D, MAX_flt without a ball) */
+    EMF_NetActivity ClassifyPlayer(bool bStunned, bool bHasBall, float Speed, float BallDistance) const;
+
+    /** Activity of a ball */
+    EMF_NetActivity ClassifyBall(EMF_BallState State, float Speed) const;
+
+    /**
+     * Move Actor to the tier for NewActivity if it differs from InOutActivity (Server only).
+     * Moving to a busier tier forces an update so the change isn't held back by the old, slower rate.
+     */
+    void ApplyNetActivity(AActor &Actor, EMF_NetActivity &InOutActivity, EMF_NetActivity NewActivity) const;
+
+    virtual FName GetCategoryName() const override
+    {
+        return TEXT("Game");
+    }
+};